@@ -17,7 +17,7 @@
  *
  * Name:    EventRecorderConf.h
  * Purpose: Event Recorder software component configuration options
- * Rev.:    V1.1.0
+ * Rev.:    V1.2.0
  */
 
 //-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
@@ -32,6 +32,84 @@
 //   <i>Must be 2^n (min=8, max=65536)
 #define EVENT_RECORD_COUNT      64U
 
+//   <o>Buffer Full Mode
+//      <0=> Overwrite oldest records  <1=> Drop new events  <2=> Stop recording
+//   <i>Selects the behavior when unread records would be overwritten
+//   <i>(records are read when the consumer calls EventRecorderAcknowledge
+//   <i> or the debugger advances records_read in EventStatus)
+#define EVENT_BUFFER_MODE       0
+
+//   <o>Value Predicates <0-16>
+//   <i>Number of value predicates checked for events that pass the event filter
+//   <i>(0 disables predicates; configured with EventRecorderPredicateSet)
+#define EVENT_PREDICATES        0U
+
+//   <q>Control Channel
+//   <i>Executes commands (enable/disable events, start/stop, trigger, snapshot period)
+//   <i>received by EventRecorderControl or written by the host to the control mailbox
+//   <i>(mailbox is polled with EventRecorderControlPoll)
+#define EVENT_CONTROL           0
+
+//   <q>Coalesce Repeated Events
+//   <i>Records consecutive identical EventRecord2 events of the same context once,
+//   <i>followed by one record with the number of repeats when the sequence ends
+#define EVENT_COALESCE          0
+
+//   <q>Lazy Buffer Initialization
+//   <i>Initializes the Event Record Buffer without clearing the records
+//   <i>(initialization time does not depend on the Number of Records;
+//   <i> requires a debugger that reads only records up to the record index)
+#define EVENT_LAZY_INIT         0
+
+//   <q>Committed Record Index
+//   <i>Publishes the record index up to which all records are completely written
+//   <i>(record_committed of EventStatus, protocol version 1.2) for debuggers that read only new records
+#define EVENT_COMMIT_INDEX      0
+
+//   <e>Fill-Level Watermarks
+//   <i>Notifies the consumer once when the number of unread records reaches
+//   <i>the High Watermark and once when it drops to the Low Watermark
+//   <i>(EventRecorderWatermark callback and EventRecorderWatermarkPending)
+#define EVENT_WATERMARK         0
+
+//     <o>High Watermark [records] <1-65536>
+//     <i>Must not exceed the Number of Records
+#define EVENT_WATERMARK_HIGH    48U
+
+//     <o>Low Watermark [records] <0-65535>
+//     <i>Must be below the High Watermark
+#define EVENT_WATERMARK_LOW     8U
+
+//   </e>
+
+//   <e>Reserved Partition
+//   <i>Records events of selected levels and components in a separate buffer
+//   <i>that is not overwritten by events of other levels and components
+//   <i>(records are merged with the Event Record Buffer by the debugger)
+#define EVENT_PARTITION         0
+
+//     <o>Number of Records
+//       <8=>8 <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>Configures size of Reserved Partition (each record is 20 bytes)
+#define EVENT_PARTITION_COUNT   16U
+
+//     <o.0>Level Error
+//     <o.1>Level API
+//     <o.2>Level Operation
+//     <o.3>Level Detail
+//     <i>Events of the selected levels are recorded in the Reserved Partition
+#define EVENT_PARTITION_LEVEL   0x01U
+
+//     <o>First Component <0x00-0xFF>
+//     <i>Events of components in the range First .. Last Component
+//     <i>are recorded in the Reserved Partition (none when First > Last)
+#define EVENT_PARTITION_COMP_FIRST 0x01U
+
+//     <o>Last Component <0x00-0xFF>
+#define EVENT_PARTITION_COMP_LAST  0x00U
+
+//   </e>
+
 //   <o>Time Stamp Source
 //      <0=> DWT Cycle Counter  <1=> SysTick  <2=> CMSIS-RTOS2 System Timer
 //      <3=> User Timer (Normal Reset)  <4=> User Timer (Power-On Reset)
@@ -42,6 +120,102 @@
 //   <i>Defines initial time stamp clock frequency (0 when not used)
 #define EVENT_TIMESTAMP_FREQ    0U
 
+//   <h>Semihosting Log File
+//   <i>Settings for the variant Semihosting
+
+//     <q>Compress Event Data
+//     <i>Compresses data of EventRecordData and EventRecordFragment
+//     <i>events written to the log file (reduces host file size)
+#define EVENT_LOG_COMPRESSION   0
+
+//     <o>Compression Window [bytes] <1-128>
+//     <i>Defines the distance searched for repeated data
+//     <i>(larger values find more repetitions but take longer)
+#define EVENT_LOG_COMPRESS_WINDOW 16U
+
+//   </h>
+
+//   <e>ITM Streaming
+//   <i>Streams each event record additionally through ITM stimulus ports (SWO)
+//   <i>(requires ITM, for example Cortex-M3/M4/M7/M33; ports are enabled by the debugger)
+#define EVENT_ITM               0
+
+//     <o>Stimulus Port <0-30>
+//     <i>Port for the first word of each record,
+//     <i>the next port for timestamp and values
+#define EVENT_ITM_PORT          8U
+
+//     <o>FIFO Wait Limit <1-1000000>
+//     <i>Number of polls of a stimulus port until the ITM FIFO accepts a word;
+//     <i>the record is dropped and counted as rejected when the limit is reached
+#define EVENT_ITM_WAIT          10000U
+
+//   </e>
+
+//   <e>Thread Tagging
+//   <i>Tags each event with the index of the CMSIS-RTOS2 thread that recorded it
+//   <i>(threads are added to a table when they record the first event)
+#define EVENT_THREAD_TAGGING    0
+
+//     <o>Maximum Number of Threads <1-63>
+//     <i>Events of further threads are tagged as unknown thread
+#define EVENT_THREAD_MAX        15U
+
+//   </e>
+
+//   <e>IRQ Tracing
+//   <i>Records entry and exit of interrupts that are enabled with EventRecorderIrqTraceEnable
+//   <i>(vector table is relocated to RAM and the traced vectors call a trampoline)
+#define EVENT_IRQ_TRACING       0
+
+//     <o>Number of Vectors <16-512>
+//     <i>Defines the size of the relocated vector table
+//     <i>(16 system exceptions and the device specific interrupts)
+#define EVENT_IRQ_VECTORS       64U
+
+//   </e>
+
+//   <e>Execution Statistics Aggregation
+//   <i>Aggregates Start/Stop events (EventStart/EventStop) on the target
+//   <i>in a table with count, total, min and max time for each slot
+#define EVENT_STATISTICS        0
+
+//     <o>Record Start/Stop Events
+//        <0=> Off  <1=> Start and Stop Events  <2=> Duration Events
+//     <i>Records Start/Stop events additionally to the aggregation
+//     <i>Duration Events: one event with the duration measured on the target
+//     <i>for each Start/Stop pair (Start events are not recorded)
+#define EVENT_STATISTICS_RECORD 0
+
+//     <o>Snapshot Period [ms] <0-3600000>
+//     <i>Defines the period for recording the aggregated statistics
+//     <i>(0 when recorded only by EventRecorderStatisticsSnapshot)
+#define EVENT_STATISTICS_PERIOD 1000U
+
+//     <e>Duration Histogram
+//     <i>Counts the Start/Stop durations of each slot in 16 buckets
+//     <i>with logarithmic (power of 2) bucket limits
+#define EVENT_STATISTICS_HIST   0
+
+//       <o>First Bucket Limit [2^n timer ticks] <0-24>
+//       <i>Durations below 2^n timer ticks are counted in the first bucket,
+//       <i>each further bucket doubles the limit
+#define EVENT_STATISTICS_HIST_BASE 0U
+
+//     </e>
+
+//     <q>Energy Sampling
+//     <i>Samples the power with EventRecorderPowerGetSample on each Start/Stop event
+//     <i>and accumulates the energy of each slot
+#define EVENT_STATISTICS_ENERGY 0
+
+//   </e>
+
+//   <q>Recorder Self-Profiling
+//   <i>Measures the overhead of the Event Recorder: time spent in record functions,
+//   <i>lock retries, maximum time with masked interrupts and peak event rate
+#define EVENT_PROFILING         0
+
 // </h>
 
 //------------- <<< end of configuration section >>> ---------------------------
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __EVENT_RECORD_H
+#define __EVENT_RECORD_H
+
+#if !defined(__cplusplus) || (__cplusplus < 201703L)
+#error "EventRecord.h requires C++17"
+#endif
+
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+#include "EventRecorder.h"
+
+namespace Event {
+
+namespace detail {
+
+/// Argument is recorded as one 32-bit value (integer, enumeration, pointer or float up to 32-bit)
+template <typename T>
+inline constexpr bool is_word_v = std::is_scalar_v<T> && !std::is_member_pointer_v<T> && (sizeof(T) <= 4U);
+
+/// Convert argument to 32-bit value (integers are converted, other types are copied bitwise)
+template <typename T>
+inline uint32_t to_word (const T &arg) noexcept {
+  if constexpr (std::is_integral_v<T>) {
+    return static_cast<uint32_t>(arg);
+  } else if constexpr (std::is_enum_v<T>) {
+    return static_cast<uint32_t>(static_cast<std::underlying_type_t<T>>(arg));
+  } else if constexpr (std::is_pointer_v<T>) {
+    return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(arg));
+  } else {
+    uint32_t val = 0U;
+    memcpy(&val, &arg, sizeof(T));
+    return val;
+  }
+}
+
+/// Maximum size of data of several arguments that is packed in a buffer on the stack
+inline constexpr uint32_t pack_max = 64U;
+
+/// Copy arguments to a byte buffer (packed, in order of arguments)
+template <typename... Args>
+inline void pack (uint8_t *buf, const Args &... args) noexcept {
+  ((memcpy(buf, &args, sizeof(Args)), buf += sizeof(Args)), ...);
+}
+
+/// Record arguments directly from their storage as fragments of one event (one fragment per argument)
+template <uint32_t ID, typename... Args>
+inline uint32_t fragments (uint32_t size, const Args &... args) noexcept {
+  const uint32_t xfer   = EventRecordTransferID();
+  uint32_t       offset = 0U;
+  uint32_t       ret    = 1U;
+  ((ret &= EventRecordFragment(ID, xfer, size, offset, &args, sizeof(Args)), offset += sizeof(Args)), ...);
+  return ret;
+}
+
+} // namespace detail
+
+/// Record an event with typed data, the record function is selected at compile-time:
+///  - up to 2 values (32-bit)          : \ref EventRecord2
+///  - up to 4 values (32-bit)          : \ref EventRecord4
+///  - other data up to 8 or 16 bytes   : \ref EventRecord2 or \ref EventRecord4 with packed data
+///  - one argument with other data     : \ref EventRecordDataLarge from the argument
+///  - several arguments up to 64 bytes : \ref EventRecordDataLarge with packed data
+///  - several arguments                : \ref EventRecordFragment for each argument
+/// \tparam       ID     event identifier (see \ref EventID)
+/// \param[in]    args   event data (trivially copyable types)
+/// \return       status (1=Success, 0=Failure)
+template <uint32_t ID, typename... Args>
+inline uint32_t record (const Args &... args) noexcept {
+  static_assert((ID & ~0x3FFFFU) == 0U, "Event::record: invalid event id (bits 18..31 must be 0)");
+  static_assert((((ID >> 8) & 0xFFU) != EvtStatistics_No) &&
+                (((ID >> 8) & 0xFFU) != EvtPrintf_No)     &&
+                (((ID >> 8) & 0xFFU) != 0xFFU),
+                "Event::record: component number is reserved (0xEF, 0xFE, 0xFF)");
+  static_assert((std::is_trivially_copyable_v<Args> && ...), "Event::record: argument type is not trivially copyable");
+
+  constexpr uint32_t size = (0U + ... + static_cast<uint32_t>(sizeof(Args)));
+  static_assert(size <= 65535U, "Event::record: event data exceeds 65535 bytes");
+
+  // Event filter is checked inline before the data is converted
+  if (EventRecorderFilterCheck(ID) == 0U) {
+    return 1U;
+  }
+
+  if constexpr ((sizeof...(Args) <= 2U) && (detail::is_word_v<Args> && ...)) {
+    const uint32_t val[2] = { detail::to_word(args)... };    // unused values are 0
+    return EventRecord2(ID, val[0], val[1]);
+  } else if constexpr ((sizeof...(Args) <= 4U) && (detail::is_word_v<Args> && ...)) {
+    const uint32_t val[4] = { detail::to_word(args)... };    // unused values are 0
+    return EventRecord4(ID, val[0], val[1], val[2], val[3]);
+  } else if constexpr (size <= 16U) {
+    uint32_t val[4] = { 0U, 0U, 0U, 0U };
+    detail::pack(reinterpret_cast<uint8_t *>(val), args...);
+    if constexpr (size <= 8U) {
+      return EventRecord2(ID, val[0], val[1]);
+    } else {
+      return EventRecord4(ID, val[0], val[1], val[2], val[3]);
+    }
+  } else if constexpr (sizeof...(Args) == 1U) {
+    // Maximum length of EventRecordData depends on the configuration (EVENT_DATA_MAX_LENGTH)
+    return EventRecordDataLarge(ID, &args..., size);
+  } else if constexpr (size <= detail::pack_max) {
+    uint8_t buf[size];
+    detail::pack(buf, args...);
+    return EventRecordDataLarge(ID, buf, size);
+  } else {
+    // Large data is not copied to the stack
+    return detail::fragments<ID>(size, args...);
+  }
+}
+
+} // namespace Event
+
+#endif /* __EVENT_RECORD_H */
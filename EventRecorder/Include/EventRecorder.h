@@ -47,6 +47,37 @@ extern "C" {
 #define EventRecordDetail       0x08U       ///< Record events with level \ref EventLevelDetail
 #define EventRecordAll          0x0FU       ///< Record events with any level
 
+// Defines for parameter event of EventRecorderWatermark
+#define EventWatermarkHigh      0x01U       ///< Number of unread records reached the high watermark
+#define EventWatermarkLow       0x02U       ///< Number of unread records dropped to the low watermark
+
+// Defines for parameter op of EventRecorderPredicateSet (values are compared unsigned)
+#define EventPredicateNone      0x00U       ///< Predicate is not used
+#define EventPredicateEQ        0x01U       ///< Value equal to constant
+#define EventPredicateNE        0x02U       ///< Value not equal to constant
+#define EventPredicateLT        0x03U       ///< Value less than constant
+#define EventPredicateLE        0x04U       ///< Value less than or equal to constant
+#define EventPredicateGT        0x05U       ///< Value greater than constant
+#define EventPredicateGE        0x06U       ///< Value greater than or equal to constant
+#define EventPredicateAnySet    0x07U       ///< Any bit of constant is set in value
+#define EventPredicateAllClr    0x08U       ///< All bits of constant are clear in value
+
+// Defines for commands of EventRecorderControl and the control mailbox
+// (byte [0]=command, bytes [1..3]=parameters, bytes [4..7]=argument in little-endian)
+#define EventControlLength      8U          ///< Length of a command in bytes
+#define EventControlEnable      0x01U       ///< Enable events: [1]=level mask, [2]=first component, [3]=last component
+#define EventControlDisable     0x02U       ///< Disable events: [1]=level mask, [2]=first component, [3]=last component
+#define EventControlStart       0x03U       ///< Start event recording
+#define EventControlStop        0x04U       ///< Stop event recording
+#define EventControlTrigger     0x05U       ///< Arm trigger: [4..7]=event identifier, [1..2]=number of events recorded after the trigger event
+#define EventControlTriggerOff  0x06U       ///< Disarm trigger
+#define EventControlPeriod      0x07U       ///< Set snapshot period of execution statistics: [4..7]=period in ms
+
+/// Event filter profile (same layout as the event filter of the Event Recorder)
+typedef struct {
+  uint32_t mask[32];                        ///< Enable bits: byte [32*level + comp_no/8], bit [comp_no%8]
+} EventRecorderFilter_t;
+
 
 // Callback function for user provided timer -----------------------------------
 
@@ -63,6 +94,20 @@ extern uint32_t EventRecorderTimerGetFreq (void);
 extern uint32_t EventRecorderTimerGetCount (void);
 
 
+// Callback function for user provided power measurement -----------------------
+
+/// Get power sample for energy of execution statistics.
+/// \return       power in uW (for example measured current multiplied with supply voltage)
+extern uint32_t EventRecorderPowerGetSample (void);
+
+
+// Callback function for fill-level watermark notification --------------------
+
+/// Notification of a fill-level watermark crossing (called by record functions and EventRecorderAcknowledge).
+/// \param[in]    event       \ref EventWatermarkHigh or \ref EventWatermarkLow
+extern void EventRecorderWatermark (uint32_t event);
+
+
 // Event Recorder Setup Functions ----------------------------------------------
 
 /// Initialize Event Recorder
@@ -85,6 +130,55 @@ extern uint32_t EventRecorderEnable (uint32_t recording, uint32_t comp_start, ui
 /// \return       status (1=Success, 0=Failure)
 extern uint32_t EventRecorderDisable (uint32_t recording, uint32_t comp_start, uint32_t comp_end);
 
+/// Enable events with specified level and component range in a filter profile
+/// \param[out]   filter      pointer to filter profile
+/// \param[in]    recording   level mask for event record filter
+/// \param[in]    comp_start  first component number of range
+/// \param[in]    comp_end    last Component number of range
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventRecorderFilterEnable (EventRecorderFilter_t *filter,
+                                           uint32_t recording, uint32_t comp_start, uint32_t comp_end);
+
+/// Disable events with specified level and component range in a filter profile
+/// \param[out]   filter      pointer to filter profile
+/// \param[in]    recording   level mask for event record filter
+/// \param[in]    comp_start  first component number of range
+/// \param[in]    comp_end    last Component number of range
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventRecorderFilterDisable (EventRecorderFilter_t *filter,
+                                            uint32_t recording, uint32_t comp_start, uint32_t comp_end);
+
+/// Get current event filter settings
+/// \param[out]   filter      pointer to filter profile
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventRecorderFilterGet (EventRecorderFilter_t *filter);
+
+/// Apply filter profile to event filter
+/// \param[in]    filter      pointer to filter profile
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventRecorderFilterSet (const EventRecorderFilter_t *filter);
+
+/// Set value predicate for events that pass the event filter
+/// \param[in]    n           predicate number (0 .. EVENT_PREDICATES-1)
+/// \param[in]    id          event identifier (level, component number, message number)
+/// \param[in]    id_mask     mask of compared identifier bits
+/// \param[in]    index       index of 32-bit value (0=val1, 1=val2, ...)
+/// \param[in]    op          comparison (EventPredicateXX, \ref EventPredicateNone clears the predicate)
+/// \param[in]    value       constant compared with the value
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventRecorderPredicateSet (uint32_t n, uint32_t id, uint32_t id_mask,
+                                           uint32_t index, uint32_t op, uint32_t value);
+
+/// Execute control commands received by a user transport (for example UART or semihosting)
+/// \param[in]    data        pointer to commands (\ref EventControlLength bytes each)
+/// \param[in]    len         length of commands in bytes
+/// \return       number of executed commands
+extern uint32_t EventRecorderControl (const void *data, uint32_t len);
+
+/// Execute pending command of the control mailbox (written by the host)
+/// \return       number of executed commands (0 or 1)
+extern uint32_t EventRecorderControlPoll (void);
+
 /// Start event recording
 /// \return       status (1=Success, 0=Failure)
 extern uint32_t EventRecorderStart (void);
@@ -97,6 +191,42 @@ extern uint32_t EventRecorderStop (void);
 /// \return       status (1=Success, 0=Failure)
 extern uint32_t EventRecorderClockUpdate (void);
 
+/// Record snapshot of execution statistics (aggregated Start/Stop events)
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventRecorderStatisticsSnapshot (void);
+
+/// Reset execution statistics (aggregated Start/Stop events)
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventRecorderStatisticsReset (void);
+
+/// Record snapshot of recorder self-profiling counters (overhead, lock retries, masked interrupts, peak event rate)
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventRecorderProfileSnapshot (void);
+
+/// Register a thread for thread tagging (for example on thread creation)
+/// \param[in]    thread_id   thread identifier (osThreadId_t)
+/// \return       thread index (1..63), 0=Failure
+extern uint32_t EventRecorderThreadRegister (void *thread_id);
+
+/// Acknowledge records read from the event buffer (allows recording when buffer full mode is configured)
+/// \param[in]    count       number of records read
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventRecorderAcknowledge (uint32_t count);
+
+/// Get and clear pending fill-level watermark notifications
+/// \return       pending notifications (\ref EventWatermarkHigh, \ref EventWatermarkLow)
+extern uint32_t EventRecorderWatermarkPending (void);
+
+/// Enable tracing of interrupt entry and exit (vector table is relocated to RAM when called first time)
+/// \param[in]    irqn        interrupt number (IRQn_Type, negative for system exceptions)
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventRecorderIrqTraceEnable (int32_t irqn);
+
+/// Disable tracing of interrupt entry and exit
+/// \param[in]    irqn        interrupt number (IRQn_Type, negative for system exceptions)
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventRecorderIrqTraceDisable (int32_t irqn);
+
 
 // Event Data Recording Functions ----------------------------------------------
 
@@ -123,6 +253,112 @@ extern uint32_t EventRecord2 (uint32_t id, uint32_t val1, uint32_t val2);
 /// \return       status (1=Success, 0=Failure)
 extern uint32_t EventRecord4 (uint32_t id, uint32_t val1, uint32_t val2, uint32_t val3, uint32_t val4);
 
+/// Get a new transfer identifier for fragmented event data
+/// \return       transfer identifier (16-bit)
+extern uint32_t EventRecordTransferID (void);
+
+/// Record a fragment of an event with large data size
+/// \param[in]    id      event identifier (level, component number, message number)
+/// \param[in]    xfer    transfer identifier (see \ref EventRecordTransferID)
+/// \param[in]    total   total length of event data (max 65535 bytes)
+/// \param[in]    offset  offset of fragment data within event data
+/// \param[in]    data    fragment data buffer
+/// \param[in]    len     fragment data length
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventRecordFragment (uint32_t id, uint32_t xfer, uint32_t total, uint32_t offset,
+                                     const void *data, uint32_t len);
+
+/// Record an event with large data size (split into fragments)
+/// \param[in]    id     event identifier (level, component number, message number)
+/// \param[in]    data   event data buffer
+/// \param[in]    len    event data length (max 65535 bytes)
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventRecordDataLarge (uint32_t id, const void *data, uint32_t len);
+
+
+// Inline Event Filter Check ---------------------------------------------------
+
+#ifndef EVENT_RECORDER_INLINE
+#if   defined(__CC_ARM)
+#define EVENT_RECORDER_INLINE   static __inline
+#else
+#define EVENT_RECORDER_INLINE   static inline
+#endif
+#endif
+
+// Event Recorder Status and Event Filter of EventRecorder.c (debugger-visible layout, see EventRecorderInfo):
+// recorder state is the first byte of EventStatus, filter bit [comp%8] of byte [32*level + comp/8] enables a component
+extern struct EventStatus_s EventStatus;
+extern uint32_t EventFilter[32];
+
+/// Check if recording is running and an event passes the event filter (without call into the Event Recorder)
+/// \param[in]    id     event identifier (level, component number, message number)
+/// \return       1=Enabled, 0=Disabled
+EVENT_RECORDER_INLINE uint32_t EventRecorderFilterCheck (uint32_t id) {
+  uint32_t ret;
+
+  ret = 0U;
+  if (*((const volatile uint8_t *)&EventStatus) != 0U) {
+    ret = ((uint32_t)((const volatile uint8_t *)EventFilter)[(id >> (8 + 3)) & 0x7FU] >> ((id >> 8) & 0x7U)) & 1U;
+  }
+  return (ret);
+}
+
+/// Record an event with variable data size when it passes the inline event filter check
+/// \param[in]    id     event identifier (level, component number, message number)
+/// \param[in]    data   event data buffer
+/// \param[in]    len    event data length
+/// \return       status (1=Success, 0=Failure)
+EVENT_RECORDER_INLINE uint32_t EventRecordDataInline (uint32_t id, const void *data, uint32_t len) {
+  uint32_t ret;
+
+  ret = 1U;
+  if (EventRecorderFilterCheck(id) != 0U) {
+    ret = EventRecordData(id, data, len);
+  }
+  return (ret);
+}
+
+/// Record an event with two 32-bit data values when it passes the inline event filter check
+/// \param[in]    id     event identifier (level, component number, message number)
+/// \param[in]    val1   first data value
+/// \param[in]    val2   second data value
+/// \return       status (1=Success, 0=Failure)
+EVENT_RECORDER_INLINE uint32_t EventRecord2Inline (uint32_t id, uint32_t val1, uint32_t val2) {
+  uint32_t ret;
+
+  ret = 1U;
+  if (EventRecorderFilterCheck(id) != 0U) {
+    ret = EventRecord2(id, val1, val2);
+  }
+  return (ret);
+}
+
+/// Record an event with four 32-bit data values when it passes the inline event filter check
+/// \param[in]    id     event identifier (level, component number, message number)
+/// \param[in]    val1   first data value
+/// \param[in]    val2   second data value
+/// \param[in]    val3   third data value
+/// \param[in]    val4   fourth data value
+/// \return       status (1=Success, 0=Failure)
+EVENT_RECORDER_INLINE uint32_t EventRecord4Inline (uint32_t id, uint32_t val1, uint32_t val2, uint32_t val3, uint32_t val4) {
+  uint32_t ret;
+
+  ret = 1U;
+  if (EventRecorderFilterCheck(id) != 0U) {
+    ret = EventRecord4(id, val1, val2, val3, val4);
+  }
+  return (ret);
+}
+
+// Define EVENT_RECORDER_INLINE_FILTER to check the event filter inline for all calls
+// of EventRecordData, EventRecord2 and EventRecord4 (including Event Start/Stop macros)
+#ifdef EVENT_RECORDER_INLINE_FILTER
+#define EventRecordData(id, data, len)              EventRecordDataInline((id), (data), (len))
+#define EventRecord2(id, val1, val2)                EventRecord2Inline((id), (val1), (val2))
+#define EventRecord4(id, val1, val2, val3, val4)    EventRecord4Inline((id), (val1), (val2), (val3), (val4))
+#endif
+
 
 // Event Start/Stop macros for execution statistics ----------------------------
 
@@ -190,6 +426,40 @@ extern uint32_t EventRecord4 (uint32_t id, uint32_t val1, uint32_t val2, uint32_
 /// \param[in]    v2     second data value
 #define EventStopDv(slot, v1, v2)  EventRecord2 (0xEFF0U+EventLevelDetail+((slot) & 0xFU), (v1), (v2))
 
+
+// Extended execution statistics (handle based, up to 65535 measurement points)
+
+/// Register a measurement point for extended execution statistics
+/// \param[in]    name   name of measurement point (string constant)
+/// \return       handle (1..65535), 0=Failure
+extern uint32_t EventStatisticsRegister (const char *name);
+
+/// Record start event for extended execution statistics
+/// \param[in]    handle handle of measurement point
+/// \param[in]    val    data value
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventStatisticsStart (uint32_t handle, uint32_t val);
+
+/// Record stop event for extended execution statistics
+/// \param[in]    handle handle of measurement point
+/// \param[in]    val    data value
+/// \return       status (1=Success, 0=Failure)
+extern uint32_t EventStatisticsStop (uint32_t handle, uint32_t val);
+
+/// \param[in]    handle handle of measurement point (see \ref EventStatisticsRegister)
+#define EventStartX(handle)        EventStatisticsStart ((handle), __LINE__)
+
+/// \param[in]    handle handle of measurement point (see \ref EventStatisticsRegister)
+/// \param[in]    v      data value
+#define EventStartXv(handle, v)    EventStatisticsStart ((handle), (v))
+
+/// \param[in]    handle handle of measurement point (see \ref EventStatisticsRegister)
+#define EventStopX(handle)         EventStatisticsStop  ((handle), __LINE__)
+
+/// \param[in]    handle handle of measurement point (see \ref EventStatisticsRegister)
+/// \param[in]    v      data value
+#define EventStopXv(handle, v)     EventStatisticsStop  ((handle), (v))
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __EVENT_SCOPE_H
+#define __EVENT_SCOPE_H
+
+#if !defined(__cplusplus) || (__cplusplus < 201703L)
+#error "EventScope.h requires C++17"
+#endif
+
+#include <stdint.h>
+#include "EventRecorder.h"
+
+// Compile-time filter: level mask of start/stop groups (EventRecordError=A .. EventRecordDetail=D)
+// that are compiled in; scopes of other groups compile to nothing
+#ifndef EVENT_SCOPE_RECORDING
+#define EVENT_SCOPE_RECORDING   EventRecordAll
+#endif
+
+
+/// Start/stop group for execution statistics (mapped to event level)
+enum class EventGroup : uint32_t {
+  A = 0U,                                   ///< Group A (level \ref EventLevelError)
+  B = 1U,                                   ///< Group B (level \ref EventLevelAPI)
+  C = 2U,                                   ///< Group C (level \ref EventLevelOp)
+  D = 3U                                    ///< Group D (level \ref EventLevelDetail)
+};
+
+/// Event identifiers and compile-time filter of a start/stop slot
+template <EventGroup Group, uint32_t Slot>
+struct EventSlot {
+  static_assert(Slot <= 15U, "EventScope: slot number out of range (0..15)");
+
+  static constexpr uint32_t group   = static_cast<uint32_t>(Group);
+  static constexpr bool     enabled = (EVENT_SCOPE_RECORDING & (1U << group)) != 0U;
+
+  // Message number: [7..6]=group, [5]=stop, [4]=values, [3..0]=slot
+  static constexpr uint32_t StartID  = 0xEF00U + (group << 16) + (group << 6) + 0x00U + Slot;  ///< EventStartG
+  static constexpr uint32_t StartVID = 0xEF00U + (group << 16) + (group << 6) + 0x10U + Slot;  ///< EventStartGv
+  static constexpr uint32_t StopID   = 0xEF00U + (group << 16) + (group << 6) + 0x20U + Slot;  ///< EventStopG
+  static constexpr uint32_t StopVID  = 0xEF00U + (group << 16) + (group << 6) + 0x30U + Slot;  ///< EventStopGv
+};
+
+/// Scoped start/stop event: records EventStart<i>G</i> on construction and EventStop<i>G</i> on destruction
+/// (filename and line number of the scope)
+template <EventGroup Group, uint32_t Slot>
+class EventScope {
+  using slot = EventSlot<Group, Slot>;
+
+  const char *file_;
+  uint32_t    line_;
+
+public:
+  /// \param[in]    file   filename (use macro \ref EVENT_SCOPE)
+  /// \param[in]    line   line number
+  EventScope (const char *file, uint32_t line) noexcept : file_(file), line_(line) {
+    if constexpr (slot::enabled) {
+      (void)EventRecord2(slot::StartID, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(file_)), line_);
+    }
+  }
+
+  ~EventScope () noexcept {
+    if constexpr (slot::enabled) {
+      (void)EventRecord2(slot::StopID, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(file_)), line_);
+    }
+  }
+
+  EventScope (const EventScope &) = delete;
+  EventScope &operator= (const EventScope &) = delete;
+};
+
+/// Scoped start/stop event with values: records EventStart<i>G</i>v on construction and EventStop<i>G</i>v on destruction
+template <EventGroup Group, uint32_t Slot>
+class EventScopeV {
+  using slot = EventSlot<Group, Slot>;
+
+  uint32_t v1_;
+  uint32_t v2_;
+
+public:
+  /// \param[in]    v1     first data value (recorded by start and stop event)
+  /// \param[in]    v2     second data value (recorded by start and stop event)
+  EventScopeV (uint32_t v1, uint32_t v2) noexcept : v1_(v1), v2_(v2) {
+    if constexpr (slot::enabled) {
+      (void)EventRecord2(slot::StartVID, v1_, v2_);
+    }
+  }
+
+  ~EventScopeV () noexcept {
+    if constexpr (slot::enabled) {
+      (void)EventRecord2(slot::StopVID, v1_, v2_);
+    }
+  }
+
+  /// Set data values recorded by the stop event
+  /// \param[in]    v1     first data value
+  /// \param[in]    v2     second data value
+  void set (uint32_t v1, uint32_t v2) noexcept {
+    v1_ = v1;
+    v2_ = v2;
+  }
+
+  EventScopeV (const EventScopeV &) = delete;
+  EventScopeV &operator= (const EventScopeV &) = delete;
+};
+
+#define EVENT_SCOPE_CONCAT_(a, b)   a##b
+#define EVENT_SCOPE_CONCAT(a, b)    EVENT_SCOPE_CONCAT_(a, b)
+
+/// Measure execution time of the enclosing scope
+/// \param[in]    group  start/stop group (A, B, C, D)
+/// \param[in]    slot   slot number (0..15)
+#define EVENT_SCOPE(group, slot) \
+  EventScope<EventGroup::group, (slot)> EVENT_SCOPE_CONCAT(event_scope_, __LINE__) (__FILE__, __LINE__)
+
+#endif /* __EVENT_SCOPE_H */
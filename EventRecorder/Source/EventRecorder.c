@@ -27,10 +27,11 @@
 #endif
 
 #include <string.h>
+#undef  EVENT_RECORDER_INLINE_FILTER   // record functions are defined here
 #include "EventRecorder.h"
 #include "EventRecorderConf.h"
 
-#if (EVENT_TIMESTAMP_SOURCE == 2)
+#if ((EVENT_TIMESTAMP_SOURCE == 2) || (defined(EVENT_THREAD_TAGGING) && (EVENT_THREAD_TAGGING != 0)))
 #include "cmsis_os2.h"
 #endif
 
@@ -78,12 +79,32 @@
 #define MID_EVENT_START         0x01U   // Start Recorder
 #define MID_EVENT_STOP          0x02U   // Stop Recorder
 #define MID_EVENT_CLOCK         0x03U   // Clock changed
+#define MID_EVENT_THREAD        0x04U   // Thread switch (event buffer)
+#define MID_EVENT_THREAD_REG    0x05U   // Register thread index
+#define MID_EVENT_IRQ_ENTRY     0x06U   // Entry of traced exception
+#define MID_EVENT_IRQ_EXIT      0x07U   // Exit of traced exception
+#define MID_EVENT_IRQ_TRACE     0x08U   // Tracing of exception enabled
+#define MID_EVENT_IRQ_TABLE     0x09U   // Vector table relocated
+#define MID_EVENT_STAT_REG      0x10U   // Register extended statistics handle
+#define MID_EVENT_STAT_START    0x11U   // Start of extended statistics handle
+#define MID_EVENT_STAT_STOP     0x12U   // Stop of extended statistics handle
+#define MID_EVENT_STAT_DURATION 0x13U   // Duration of Start/Stop pair
+#define MID_EVENT_PROFILE       0x14U   // Recorder self-profiling snapshot
+#define MID_EVENT_REPEAT        0x15U   // Repeat count of coalesced events
+#define MID_EVENT_STAT          0x40U   // Execution statistics (0x40..0x7F)
+#define MID_EVENT_HIST          0x80U   // Duration histogram (0x80..0xBF)
+#define MID_EVENT_ENERGY        0xC0U   // Energy of execution statistics (0xC0..0xFF)
 
 //lint -emacro((835),ID_EVENT_*) "A zero has been given as argument to operator '|'"
 #define ID_EVENT_INIT   (((uint32_t)CID_EVENT << 8) | MID_EVENT_INIT  | EVENT_RECORD_FIRST | EVENT_RECORD_LAST)
 #define ID_EVENT_START  (((uint32_t)CID_EVENT << 8) | MID_EVENT_START | EVENT_RECORD_FIRST | EVENT_RECORD_LAST)
 #define ID_EVENT_STOP   (((uint32_t)CID_EVENT << 8) | MID_EVENT_STOP  | EVENT_RECORD_FIRST | EVENT_RECORD_LAST)
 #define ID_EVENT_CLOCK  (((uint32_t)CID_EVENT << 8) | MID_EVENT_CLOCK | EVENT_RECORD_FIRST | EVENT_RECORD_LAST)
+#define ID_EVENT_THREAD (((uint32_t)CID_EVENT << 8) | MID_EVENT_THREAD | EVENT_RECORD_FIRST | EVENT_RECORD_LAST)
+#define ID_EVENT_REPEAT (((uint32_t)CID_EVENT << 8) | MID_EVENT_REPEAT | EVENT_RECORD_FIRST | EVENT_RECORD_LAST)
+
+/* Thread index of items that do not switch the thread (items of interrupts and subsequent items of an event) */
+#define EVENT_THREAD_NONE       0xFFFFFFFFU
 
 /* Event Recorder Signature */
 #define SIGNATURE               0xE1A5276BU
@@ -94,6 +115,58 @@
 #error "Invalid number of Event Buffer Records!"
 #endif
 
+/* Buffer Full Mode */
+#ifndef EVENT_BUFFER_MODE
+#define EVENT_BUFFER_MODE       0
+#endif
+#if ((EVENT_BUFFER_MODE < 0) || (EVENT_BUFFER_MODE > 2))
+#error "Invalid Buffer Full Mode!"
+#endif
+
+/* Value Predicates */
+#ifndef EVENT_PREDICATES
+#define EVENT_PREDICATES        0U
+#endif
+#if (EVENT_PREDICATES > 16U)
+#error "Invalid number of Value Predicates (max 16)!"
+#endif
+
+/* Control Channel */
+#ifndef EVENT_CONTROL
+#define EVENT_CONTROL           0
+#endif
+
+/* Coalescing of Repeated Events */
+#ifndef EVENT_COALESCE
+#define EVENT_COALESCE          0
+#endif
+
+/* Lazy Buffer Initialization */
+#ifndef EVENT_LAZY_INIT
+#define EVENT_LAZY_INIT         0
+#endif
+
+/* Committed Record Index */
+#ifndef EVENT_COMMIT_INDEX
+#define EVENT_COMMIT_INDEX      0
+#endif
+
+/* Fill-Level Watermarks */
+#ifndef EVENT_WATERMARK
+#define EVENT_WATERMARK         0
+#endif
+#ifndef EVENT_WATERMARK_HIGH
+#define EVENT_WATERMARK_HIGH    (EVENT_RECORD_COUNT / 2U)
+#endif
+#ifndef EVENT_WATERMARK_LOW
+#define EVENT_WATERMARK_LOW     0U
+#endif
+#if ((EVENT_WATERMARK != 0) && \
+     ((EVENT_WATERMARK_HIGH < 1U) || (EVENT_WATERMARK_HIGH > EVENT_RECORD_COUNT) || \
+      (EVENT_WATERMARK_LOW >= EVENT_WATERMARK_HIGH)))
+#error "Invalid High/Low Watermark (0 <= Low < High <= Number of Records)!"
+#endif
+
 /* Maximum number of Locked Records */
 #define EVENT_RECORD_MAX_LOCKED 7U
 
@@ -104,6 +177,135 @@
 #define EVENT_DATA_MAX_LENGTH   ((EVENT_RECORD_COUNT / 4U) * 8U)
 #endif
 
+/* Event Fragment Header Length, Maximum Data Length per Fragment and Maximum Total Length */
+#define EVENT_FRAG_HEAD_LENGTH  8U
+#define EVENT_FRAG_MAX_LENGTH   (EVENT_DATA_MAX_LENGTH - EVENT_FRAG_HEAD_LENGTH)
+#define EVENT_FRAG_MAX_TOTAL    0xFFFFU
+
+/* Execution Statistics Aggregation */
+#ifndef EVENT_STATISTICS
+#define EVENT_STATISTICS        0
+#endif
+#ifndef EVENT_STATISTICS_RECORD
+#define EVENT_STATISTICS_RECORD 0
+#endif
+#if ((EVENT_STATISTICS_RECORD < 0) || (EVENT_STATISTICS_RECORD > 2))
+#error "Invalid Record Start/Stop Events setting for Execution Statistics!"
+#endif
+#ifndef EVENT_STATISTICS_PERIOD
+#define EVENT_STATISTICS_PERIOD 1000U
+#endif
+#if (EVENT_STATISTICS_PERIOD > 3600000U)
+#error "Invalid Snapshot Period for Execution Statistics!"
+#endif
+#ifndef EVENT_STATISTICS_HIST
+#define EVENT_STATISTICS_HIST   0
+#endif
+#ifndef EVENT_STATISTICS_HIST_BASE
+#define EVENT_STATISTICS_HIST_BASE 0U
+#endif
+#if (EVENT_STATISTICS_HIST_BASE > 24U)
+#error "Invalid First Bucket Limit for Duration Histogram!"
+#endif
+#ifndef EVENT_STATISTICS_ENERGY
+#define EVENT_STATISTICS_ENERGY 0
+#endif
+
+/* Thread Tagging */
+#ifndef EVENT_THREAD_TAGGING
+#define EVENT_THREAD_TAGGING    0
+#endif
+#ifndef EVENT_THREAD_MAX
+#define EVENT_THREAD_MAX        15U
+#endif
+#if ((EVENT_THREAD_MAX < 1U) || (EVENT_THREAD_MAX > 63U))
+#error "Invalid Maximum Number of Threads for Thread Tagging!"
+#endif
+
+/* IRQ Tracing */
+#ifndef EVENT_IRQ_TRACING
+#define EVENT_IRQ_TRACING       0
+#endif
+#ifndef EVENT_IRQ_VECTORS
+#define EVENT_IRQ_VECTORS       64U
+#endif
+#if ((EVENT_IRQ_VECTORS < 16U) || (EVENT_IRQ_VECTORS > 512U))
+#error "Invalid Number of Vectors for IRQ Tracing!"
+#endif
+#if ((EVENT_IRQ_TRACING != 0) && (__CORTEX_M < 3U) && (!defined(__VTOR_PRESENT) || (__VTOR_PRESENT == 0U)))
+#error "IRQ Tracing requires the Vector Table Offset Register (VTOR)!"
+#endif
+
+/* Reserved Partition */
+#ifndef EVENT_PARTITION
+#define EVENT_PARTITION         0
+#endif
+#ifndef EVENT_PARTITION_COUNT
+#define EVENT_PARTITION_COUNT   16U
+#endif
+#ifndef EVENT_PARTITION_LEVEL
+#define EVENT_PARTITION_LEVEL   0x01U
+#endif
+#ifndef EVENT_PARTITION_COMP_FIRST
+#define EVENT_PARTITION_COMP_FIRST 0x01U
+#endif
+#ifndef EVENT_PARTITION_COMP_LAST
+#define EVENT_PARTITION_COMP_LAST  0x00U
+#endif
+#if ((EVENT_PARTITION != 0) && \
+     ((EVENT_PARTITION_COUNT < 8U) || (EVENT_PARTITION_COUNT > 1024U) || \
+      ((EVENT_PARTITION_COUNT & (EVENT_PARTITION_COUNT - 1U)) != 0U)))
+#error "Invalid number of Records for Reserved Partition (must be 2^n, 8 .. 1024)!"
+#endif
+#if ((EVENT_PARTITION_LEVEL > 0x0FU) || (EVENT_PARTITION_COMP_FIRST > 0xFFU) || (EVENT_PARTITION_COMP_LAST > 0xFFU))
+#error "Invalid Levels or Components for Reserved Partition!"
+#endif
+
+/* ITM Streaming */
+#ifndef EVENT_ITM
+#define EVENT_ITM               0
+#endif
+#ifndef EVENT_ITM_PORT
+#define EVENT_ITM_PORT          8U
+#endif
+#if (EVENT_ITM_PORT > 30U)
+#error "Invalid Stimulus Port for ITM Streaming!"
+#endif
+#ifndef EVENT_ITM_WAIT
+#define EVENT_ITM_WAIT          10000U
+#endif
+#if ((EVENT_ITM_WAIT < 1U) || (EVENT_ITM_WAIT > 1000000U))
+#error "Invalid FIFO Wait Limit for ITM Streaming (1 .. 1000000)!"
+#endif
+#if ((EVENT_ITM != 0) && !defined(ITM))
+#error "ITM Streaming requires the Instrumentation Trace Macrocell (ITM)!"
+#endif
+
+/* Recorder Self-Profiling */
+#ifndef EVENT_PROFILING
+#define EVENT_PROFILING         0
+#endif
+
+/* Relocated vector table alignment: table size rounded up to a power of 2 (min 128 bytes) */
+#if   (EVENT_IRQ_VECTORS <= 32U)
+#define EVENT_IRQ_ALIGN         128
+#elif (EVENT_IRQ_VECTORS <= 64U)
+#define EVENT_IRQ_ALIGN         256
+#elif (EVENT_IRQ_VECTORS <= 128U)
+#define EVENT_IRQ_ALIGN         512
+#elif (EVENT_IRQ_VECTORS <= 256U)
+#define EVENT_IRQ_ALIGN         1024
+#else
+#define EVENT_IRQ_ALIGN         2048
+#endif
+
+/* Duration Histogram: number of buckets and length of recorded histogram */
+#define EVENT_HIST_BUCKETS      16U
+#define EVENT_HIST_LENGTH       (4U + (2U * EVENT_HIST_BUCKETS))
+#if ((EVENT_STATISTICS != 0) && (EVENT_STATISTICS_HIST != 0) && (EVENT_HIST_LENGTH > EVENT_DATA_MAX_LENGTH))
+#error "Duration Histogram requires at least 32 Event Records!"
+#endif
+
 /* Event Record Information */
 #define EVENT_RECORD_ID_MASK    0x0000FFFFU
 #define EVENT_RECORD_DLEN_POS   16
@@ -122,6 +324,9 @@
 #define EVENT_RECORD_MSB_VAL2   0x40000000U
 #define EVENT_RECORD_TBIT       0x80000000U
 
+/* Item of an event in the Reserved Partition (only in parameter id of EventRecordItem) */
+#define EVENT_RECORD_PART       EVENT_RECORD_TBIT
+
 /* Event Record */
 typedef struct {
   uint32_t ts;                  // Timestamp (32-bit, Toggle bit instead of MSB)
@@ -149,6 +354,23 @@ typedef struct {
 #define EVENT_TYPE_DATA         0x0001U // EventRecordData
 #define EVENT_TYPE_VAL2         0x0002U // EventRecord2
 #define EVENT_TYPE_VAL4         0x0003U // EventRecord4
+#define EVENT_TYPE_FRAG         0x0004U // EventRecordFragment
+#define EVENT_TYPE_COMPRESSED   0x8000U // Compressed event data (flag)
+
+/* Thread index in parameter id of log functions */
+#define EVENT_LOG_THREAD_POS    24
+#define EVENT_LOG_THREAD_MASK   0x3F000000U
+
+/* Compression of event data in log */
+#ifndef EVENT_LOG_COMPRESSION
+#define EVENT_LOG_COMPRESSION   0
+#endif
+#ifndef EVENT_LOG_COMPRESS_WINDOW
+#define EVENT_LOG_COMPRESS_WINDOW 16U
+#endif
+#if ((EVENT_LOG_COMPRESS_WINDOW < 1U) || (EVENT_LOG_COMPRESS_WINDOW > 128U))
+#error "Invalid Compression Window for Event Log!"
+#endif
 
 /* Event Record Header (Log) */
 typedef struct __PACKED {
@@ -162,7 +384,8 @@ typedef struct __PACKED {
   struct __PACKED {             // Record Information
     uint32_t      id : 16;      //  [ 7.. 0]: Message ID (8-bit)
                                 //  [15.. 8]: Component ID (8-bit)
-    uint32_t   rsrvd : 15;      // Reserved
+    uint32_t   rsrvd :  9;      // Reserved
+    uint32_t  thread :  6;      // Thread Index (0=IRQ or unknown thread)
     uint32_t     irq :  1;      // IRQ Flag
   } info;
   uint32_t val1;                // Value 1
@@ -175,7 +398,8 @@ typedef struct __PACKED {
   struct __PACKED {             // Record Information
     uint32_t      id : 16;      //  [ 7.. 0]: Message ID (8-bit)
                                 //  [15.. 8]: Component ID (8-bit)
-    uint32_t   rsrvd : 15;      // Reserved
+    uint32_t   rsrvd :  9;      // Reserved
+    uint32_t  thread :  6;      // Thread Index (0=IRQ or unknown thread)
     uint32_t     irq :  1;      // IRQ Flag
   } info;
   uint32_t val1;                // Value 1
@@ -190,22 +414,44 @@ typedef struct __PACKED {
   struct __PACKED{              // Record Information
     uint32_t      id : 16;      //  [ 7.. 0]: Message ID (8-bit)
                                 //  [15.. 8]: Component ID (8-bit)
-    uint32_t  length : 15;      //  Data Length
+    uint32_t  length :  9;      //  Data Length
+    uint32_t  thread :  6;      // Thread Index (0=IRQ or unknown thread)
     uint32_t     irq :  1;      // IRQ Flag
   } info;
 //uint8_t data[info.length];    // Data
 } EventRecordData_t;
 
+/* Event Fragment Header for EventRecordFragment (Log), follows EventRecordData_t */
+typedef struct __PACKED {
+  uint16_t      xfer;           // Transfer ID
+  uint16_t     total;           // Total length of event data
+  uint32_t    offset;           // Offset of fragment data
+//uint8_t data[info.length-8];  // Fragment Data
+} EventRecordFrag_t;
+
 #endif
 
 /* Event Buffer */
 static EventRecord_t EventBuffer[EVENT_RECORD_COUNT] __NO_INIT __ALIGNED(16);
 
 /* Event Filter: 1024 enable bits for 8-bit Component ID with 2-bit Level */
-static uint8_t EventFilter[128] __NO_INIT __ALIGNED(4);
+/*  byte [32*level + comp/8], bit [comp%8] (accessed as 32-bit words)   */
+//lint -esym(765, EventFilter) "Global scope (used by inline filter check)"
+uint32_t EventFilter[32] __NO_INIT;
+
+#if (EVENT_PARTITION != 0)
+/* Reserved Partition: records of selected levels and components, not overwritten by other events */
+static EventRecord_t EventBufferReserved[EVENT_PARTITION_COUNT] __NO_INIT __ALIGNED(16);
+
+/* Sequence Numbers of Reserved Partition: Event Buffer record index when the record was written */
+static uint32_t EventReservedSeq[EVENT_PARTITION_COUNT] __NO_INIT;
+
+/* Current Record Index of Reserved Partition */
+static uint32_t EventReservedIndex __NO_INIT;
+#endif
 
 /* Event Recorder Status */
-typedef struct {
+typedef struct EventStatus_s {
   uint8_t  state;               // Recorder State: 0 - Inactive, 1 - Running
   uint8_t  context;             // Current Event Context
   uint16_t info_crc;            // EventRecorderInfo CRC16-CCITT
@@ -217,9 +463,207 @@ typedef struct {
   uint32_t ts_last;             // Timestamp last value
   uint32_t init_count;          // Initialization counter
   uint32_t signature;           // Initialization signature
+  uint32_t records_read;        // Number of records read by consumer
+  uint32_t events_rejected;     // Number of events rejected while buffer full or ITM FIFO not drained
+  uint32_t record_start;        // Record Index at last initialization
+  uint32_t record_committed;    // Record Index up to which all records are completely written (Protocol Version 1.2)
 } EventStatus_t;
 
-static EventStatus_t EventStatus __NO_INIT __ALIGNED(64);
+//lint -esym(765, EventStatus) "Global scope (used by inline filter check)"
+EventStatus_t EventStatus __NO_INIT __ALIGNED(64);
+
+#if (EVENT_COMMIT_INDEX != 0)
+/* Number of records of the Event Buffer that are being written */
+static uint32_t EventWriters;
+#endif
+
+/* Transfer ID for fragmented event data */
+static uint32_t TransferID;
+
+/* Last registered handle for extended execution statistics */
+static uint32_t StatisticsHandle;
+
+/* Recorder Self-Profiling Counters */
+typedef struct {
+  uint32_t events;              // Number of recorded events
+  uint32_t time_lo;             // Total time in record functions in timer ticks (bits [31..0])
+  uint32_t time_hi;             // Total time in record functions in timer ticks (bits [63..32])
+  uint32_t retries[4];          // Records written after 0, 1, 2..3 and 4..6 lock retries
+  uint32_t irq_masked;          // Maximum time with masked interrupts in timer ticks
+  uint32_t rate_max;            // Peak event rate: maximum number of events within 1 ms
+  uint32_t rate_count;          // Number of events within current 1 ms period
+  uint32_t rate_ts;             // Timestamp of start of current 1 ms period
+} EventProfile_t;
+
+/* Length of Recorder Self-Profiling snapshot (events .. rate_max) */
+#define EVENT_PROFILE_LENGTH    36U
+
+#if (EVENT_PROFILING != 0)
+static EventProfile_t EventProfile __NO_INIT __ALIGNED(4);
+#endif
+
+#if (EVENT_WATERMARK != 0)
+/* Fill-Level Watermark State: 0 - below High Watermark, 1 - High Watermark reached */
+static uint32_t WatermarkState;
+/* Pending Watermark notifications (EventWatermarkHigh, EventWatermarkLow) */
+static uint32_t WatermarkPending;
+#endif
+
+#if (EVENT_PREDICATES != 0)
+/* Value Predicate */
+typedef struct {
+  uint32_t id;                  // Event identifier (level, component number, message number)
+  uint32_t id_mask;             // Mask of compared identifier bits
+  uint32_t value;               // Constant compared with the value
+  uint8_t  index;               // Index of 32-bit value (0 - val1, 1 - val2, ...)
+  uint8_t  op;                  // Comparison (EventPredicateXX, 0 - not used)
+  uint8_t  reserved[2];         // Reserved (must be zero)
+} EventPredicate_t;
+
+/* Value Predicates */
+static EventPredicate_t EventPredicate[EVENT_PREDICATES];
+
+/* Value Predicates in use: bit n for EventPredicate[n] */
+static uint32_t EventPredicateUsed;
+#endif
+
+/* Control Mailbox: written by the host, polled with EventRecorderControlPoll */
+typedef struct {
+  uint32_t request;             // Request counter: incremented by the host after writing the command
+  uint32_t ack;                 // Acknowledge counter: set to request by the target after executing the command
+  uint32_t status;              // Status of last command: 1 - Success, 0 - Failure
+  uint32_t reserved;            // Reserved (must be zero)
+  uint8_t  cmd[EventControlLength]; // Command (EventControlXX in byte 0)
+} EventControl_t;
+
+#if (EVENT_CONTROL != 0)
+static EventControl_t EventControl;
+
+/* Trigger States */
+#define EVENT_TRIGGER_OFF       0U
+#define EVENT_TRIGGER_ARMED     1U
+#define EVENT_TRIGGER_FIRED     2U
+
+/* Trigger: recording stops a number of events after the trigger event */
+typedef struct {
+  uint32_t state;               // Trigger State (EVENT_TRIGGER_xxx)
+  uint32_t id;                  // Trigger event identifier (level, component number, message number)
+  uint32_t count;               // Number of events still recorded after the trigger event
+} EventTrigger_t;
+
+static EventTrigger_t EventTrigger;
+#endif
+
+#if (EVENT_COALESCE != 0)
+/* Last event of a context for coalescing repeated events */
+typedef struct {
+  uint32_t id;                  // Event identifier with IRQ and partition flags, VALID flag (0 - none)
+  uint32_t val1;                // First data value
+  uint32_t val2;                // Second data value
+  uint32_t thread;              // Thread index
+  uint32_t count;               // Number of repeats not yet recorded
+  uint32_t ts;                  // Timestamp of last repeat
+} EventRepeat_t;
+
+/* Last events of thread mode [0] and handler mode [1] */
+static EventRepeat_t EventRepeat[2];
+#endif
+
+#if (EVENT_THREAD_TAGGING != 0)
+/* Thread Table: thread identifiers of tagged threads, index [thread index - 1] */
+static uint32_t EventThreadTable[EVENT_THREAD_MAX];
+
+/* Thread index of last thread switch recorded in the event buffer */
+static uint32_t EventThreadLast;
+
+#if (EVENT_ITM != 0)
+/* Thread index of last thread switch streamed through ITM */
+static uint32_t EventThreadLastITM;
+#endif
+#endif
+
+#if (EVENT_IRQ_TRACING != 0)
+/* Exception handler */
+typedef void (*EventIrqHandler_t) (void);
+
+/* Relocated vector table (traced vectors point to the trampoline) */
+static EventIrqHandler_t EventIrqVectors[EVENT_IRQ_VECTORS] __NO_INIT __ALIGNED(EVENT_IRQ_ALIGN);
+
+/* Original handlers of traced vectors, index [exception number] */
+static EventIrqHandler_t EventIrqHandlers[EVENT_IRQ_VECTORS] __NO_INIT;
+#endif
+
+#if (EVENT_STATISTICS != 0)
+
+/* Execution Statistics Slot */
+typedef struct {
+  uint32_t count;               // Number of Start/Stop pairs
+  uint32_t total_lo;            // Total time (bits [31..0])
+  uint32_t total_hi;            // Total time (bits [63..32])
+  uint32_t min;                 // Minimum time
+  uint32_t max;                 // Maximum time
+  uint32_t start;               // Timestamp of last Start event
+} EventStatistics_t;
+
+/* Execution Statistics: 4 groups (A..D) with 16 slots, index [16*group + slot] */
+static EventStatistics_t EventStatistics[64] __NO_INIT __ALIGNED(4);
+
+/* Running slots of Execution Statistics (bit mask per group) */
+static uint32_t EventStatisticsRunning[4];
+
+/* Timestamp of last Execution Statistics snapshot */
+static uint32_t EventStatisticsSnapshotTS;
+
+#if (EVENT_CONTROL != 0)
+/* Snapshot Period of Execution Statistics in ms (changed by EventControlPeriod command) */
+static uint32_t EventStatisticsPeriod = EVENT_STATISTICS_PERIOD;
+#else
+#define EventStatisticsPeriod   EVENT_STATISTICS_PERIOD
+#endif
+
+#if (EVENT_STATISTICS_HIST != 0)
+/* Duration Histogram: bucket counts for each slot, index [16*group + slot] */
+static uint32_t EventHistogram[64][EVENT_HIST_BUCKETS] __NO_INIT __ALIGNED(4);
+#endif
+
+#if (EVENT_STATISTICS_ENERGY != 0)
+/* Energy of Execution Statistics Slot */
+typedef struct {
+  uint32_t total_lo;            // Total energy in uW * timer ticks (bits [31..0])
+  uint32_t total_hi;            // Total energy in uW * timer ticks (bits [63..32])
+  uint32_t power;               // Power sample of last Start event in uW
+} EventEnergy_t;
+
+/* Energy of Execution Statistics, index [16*group + slot] */
+static EventEnergy_t EventEnergy[64] __NO_INIT __ALIGNED(4);
+#endif
+
+#endif
+
+/* Reserved Partition Information */
+typedef struct {
+  uint32_t       record_count;  // Number of Records in Reserved Partition
+  EventRecord_t *event_buffer;  // Pointer to Reserved Partition
+  uint32_t      *record_seq;    // Pointer to Sequence Numbers (Event Buffer record index)
+  uint32_t      *record_index;  // Pointer to Current Record Index of Reserved Partition
+  uint8_t        level_mask;    // Levels of events in Reserved Partition (bit mask)
+  uint8_t        comp_first;    // First component number of events in Reserved Partition
+  uint8_t        comp_last;     // Last component number of events in Reserved Partition
+  uint8_t        reserved;      // Reserved (must be zero)
+} EventPartitionInfo_t;
+
+#if (EVENT_PARTITION != 0)
+static const EventPartitionInfo_t EventPartitionInfo = {
+  EVENT_PARTITION_COUNT,
+  &EventBufferReserved[0],
+  &EventReservedSeq[0],
+  &EventReservedIndex,
+  EVENT_PARTITION_LEVEL,
+  EVENT_PARTITION_COMP_FIRST,
+  EVENT_PARTITION_COMP_LAST,
+  0U
+};
+#endif
 
 /* Global Event Recorder Information */
 typedef struct {
@@ -233,6 +677,9 @@ typedef struct {
   EventStatus_t *event_status;  // Pointer to Event Status
   uint8_t        ts_source;     // Timestamp source
   uint8_t        reserved3[3];  // Reserved (must be zero)
+  EventProfile_t *event_profile;// Pointer to Recorder Self-Profiling Counters (NULL when disabled)
+  const EventPartitionInfo_t *event_partition; // Pointer to Reserved Partition Information (NULL when disabled)
+  EventControl_t *event_control;// Pointer to Control Mailbox (NULL when disabled)
 } EventRecorderInfo_t;
 
 //lint -esym(754, EventRecorderInfo*) "Referenced   (used by debugger)"
@@ -243,28 +690,82 @@ extern const EventRecorderInfo_t EventRecorderInfo;
 __USED const EventRecorderInfo_t EventRecorderInfo =
 {
   1U, 0U,
+#if (EVENT_COMMIT_INDEX != 0)
+  0x0102U,                      // Protocol Version 1.2
+#else
   0x0101U,                      // Protocol Version 1.1
+#endif
   EVENT_RECORD_COUNT,
   &EventBuffer[0],
-  &EventFilter[0],
+  (uint8_t *)&EventFilter[0],
   &EventStatus,
   EVENT_TIMESTAMP_SOURCE,
-  { 0U, 0U, 0U }
+  { 0U, 0U, 0U },
+#if (EVENT_PROFILING != 0)
+  &EventProfile,
+#else
+  NULL,
+#endif
+#if (EVENT_PARTITION != 0)
+  &EventPartitionInfo,
+#else
+  NULL,
+#endif
+#if (EVENT_CONTROL != 0)
+  &EventControl
+#else
+  NULL
+#endif
 };
 //lint --fem
 
 
+/* Recorder Self-Profiling: time with masked interrupts */
+
+#if (EVENT_PROFILING != 0)
+
+__STATIC_INLINE uint32_t EventProfileMaskStart (void) {
+  return (EventRecorderTimerGetCount());
+}
+
+__STATIC_INLINE void EventProfileMaskEnd (uint32_t start) {
+  uint32_t time;
+
+  // Called with masked interrupts: maximum is updated without atomic operation
+  time = EventRecorderTimerGetCount() - start;
+  // Negative time is discarded (SysTick count is not updated while interrupts are masked)
+  if ((time < 0x80000000U) && (time > EventProfile.irq_masked)) {
+    EventProfile.irq_masked = time;
+  }
+}
+
+#else
+
+__STATIC_INLINE uint32_t EventProfileMaskStart (void) {
+  return 0U;
+}
+
+__STATIC_INLINE void EventProfileMaskEnd (uint32_t start) {
+  (void)start;
+}
+
+#endif
+
+
 /* Atomic operation helper functions */
 
 #if (__CORTEX_M < 3U)
 
 __STATIC_INLINE uint8_t atomic_inc_8 (uint8_t *mem) {
   uint32_t primask = __get_PRIMASK();
+  uint32_t masked;
   uint8_t  ret;
 
   __disable_irq();
+  masked = EventProfileMaskStart();
   ret = *mem;
   *mem = ret + 1U;
+  EventProfileMaskEnd(masked);
   if (primask == 0U) {
     __enable_irq();
   }
@@ -274,11 +775,14 @@ __STATIC_INLINE uint8_t atomic_inc_8 (uint8_t *mem) {
 
 __STATIC_INLINE uint32_t atomic_inc_32 (uint32_t *mem) {
   uint32_t primask = __get_PRIMASK();
+  uint32_t masked;
   uint32_t ret;
 
   __disable_irq();
+  masked = EventProfileMaskStart();
   ret = *mem;
   *mem = ret + 1U;
+  EventProfileMaskEnd(masked);
   if (primask == 0U) {
     __enable_irq();
   }
@@ -288,10 +792,12 @@ __STATIC_INLINE uint32_t atomic_inc_32 (uint32_t *mem) {
 
 __STATIC_INLINE uint32_t atomic_cmp_xch_32 (uint32_t *mem, uint32_t *expected, uint32_t desired) {
   uint32_t primask = __get_PRIMASK();
+  uint32_t masked;
   uint32_t val;
   uint32_t ret;
 
   __disable_irq();
+  masked = EventProfileMaskStart();
   val = *mem;
   if (val == *expected) {
     *mem = desired;
@@ -300,6 +806,24 @@ __STATIC_INLINE uint32_t atomic_cmp_xch_32 (uint32_t *mem, uint32_t *expected, u
     *expected = val;
     ret = 0U;
   }
+  EventProfileMaskEnd(masked);
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  return ret;
+}
+
+__STATIC_INLINE uint32_t atomic_add_32 (uint32_t *mem, uint32_t val) {
+  uint32_t primask = __get_PRIMASK();
+  uint32_t masked;
+  uint32_t ret;
+
+  __disable_irq();
+  masked = EventProfileMaskStart();
+  ret = *mem;
+  *mem = ret + val;
+  EventProfileMaskEnd(masked);
   if (primask == 0U) {
     __enable_irq();
   }
@@ -307,6 +831,32 @@ __STATIC_INLINE uint32_t atomic_cmp_xch_32 (uint32_t *mem, uint32_t *expected, u
   return ret;
 }
 
+__STATIC_INLINE void atomic_or_32 (uint32_t *mem, uint32_t val) {
+  uint32_t primask = __get_PRIMASK();
+  uint32_t masked;
+
+  __disable_irq();
+  masked = EventProfileMaskStart();
+  *mem |= val;
+  EventProfileMaskEnd(masked);
+  if (primask == 0U) {
+    __enable_irq();
+  }
+}
+
+__STATIC_INLINE void atomic_and_32 (uint32_t *mem, uint32_t val) {
+  uint32_t primask = __get_PRIMASK();
+  uint32_t masked;
+
+  __disable_irq();
+  masked = EventProfileMaskStart();
+  *mem &= val;
+  EventProfileMaskEnd(masked);
+  if (primask == 0U) {
+    __enable_irq();
+  }
+}
+
 #else /* (__CORTEX_M >= 3U) */
 
 __STATIC_INLINE uint8_t atomic_inc_8 (uint8_t *mem) {
@@ -325,6 +875,18 @@ __STATIC_INLINE uint32_t atomic_cmp_xch_32 (uint32_t *mem, uint32_t *expected, u
                                                           memory_order_relaxed));
 }
 
+__STATIC_INLINE uint32_t atomic_add_32 (uint32_t *mem, uint32_t val) {
+  return (atomic_fetch_add_explicit((_Atomic uint32_t *)mem, val, memory_order_relaxed));
+}
+
+__STATIC_INLINE void atomic_or_32 (uint32_t *mem, uint32_t val) {
+  (void)atomic_fetch_or_explicit((_Atomic uint32_t *)mem, val, memory_order_relaxed);
+}
+
+__STATIC_INLINE void atomic_and_32 (uint32_t *mem, uint32_t val) {
+  (void)atomic_fetch_and_explicit((_Atomic uint32_t *)mem, val, memory_order_relaxed);
+}
+
 #endif
 
 
@@ -344,66 +906,235 @@ __STATIC_INLINE void IncrementRecordsDumped (void) {
   (void)atomic_inc_32(&EventStatus.records_dumped);
 }
 
+#if (EVENT_COMMIT_INDEX != 0)
 
-#if (__CORTEX_M < 3U)
+/**
+  Start writing a record (counted until EventRecordCommit)
+*/
+__STATIC_INLINE void EventRecordBegin (void) {
+  (void)atomic_inc_32(&EventWriters);
+}
 
-__STATIC_INLINE uint32_t LockRecord (uint32_t *mem, uint32_t info) {
-  uint32_t primask = __get_PRIMASK();
-  uint32_t val;
+/**
+  Advance the committed record index to index (when it is below index)
+  \param[in]    index  record index
+*/
+__STATIC_INLINE void EventCommitAdvance (uint32_t index) {
+  uint32_t committed;
 
-  __disable_irq();
-  val = *mem;
-  if ((val & EVENT_RECORD_LOCKED) == 0U) {
-     val = (info | EVENT_RECORD_LOCKED) |
-           (val  & EVENT_RECORD_TBIT);
-    *mem = val;
-  } else {
-     val = 0U;
+  committed = EventStatus.record_committed;
+  while (((index - committed - 1U) < 0x80000000U) &&
+         (atomic_cmp_xch_32(&EventStatus.record_committed, &committed, index) == 0U)) {
+    ;
   }
-  if (primask == 0U) {
-    __enable_irq();
+}
+
+/**
+  Finish writing a record and publish the committed record index: advance it over the
+  completely written records, or to the record index when no other record is being written
+*/
+__STATIC_INLINE void EventRecordCommit (void) {
+  uint32_t committed;
+  uint32_t index;
+  uint32_t info;
+  uint32_t seq;
+
+  // Records are written before the committed record index is published (release)
+  __DMB();
+  if (atomic_add_32(&EventWriters, 0xFFFFFFFFU) == 1U) {
+    // Writers that start after this check get a record index >= index
+    index = EventStatus.record_index;
+    if (*((volatile uint32_t *)&EventWriters) == 0U) {
+      // Records below index are written or skipped by a writer that could not lock them
+      EventCommitAdvance(index);
+      //lint -e{904} "Return statement before end of function"
+      return;
+    }
   }
-  __COMPILER_BARRIER();
 
-  return val;
+  // Other records are being written (for example by a preempted thread):
+  // advance over the contiguous records that are valid, unlocked and of the current pass
+  index = EventStatus.record_index;
+  if ((index - EventStatus.record_committed) > EVENT_RECORD_COUNT) {
+    // Records below the last pass are overwritten (skipped record index)
+    EventCommitAdvance(index - EVENT_RECORD_COUNT);
+  }
+  committed = EventStatus.record_committed;
+  while ((index - committed - 1U) < 0x80000000U) {
+#if (EVENT_LAZY_INIT != 0)
+    // Records not yet written in the first pass after initialization may contain random data
+    if ((committed - EventStatus.record_start) < EVENT_RECORD_COUNT) {
+      break;
+    }
+#endif
+    seq  = ((committed / EVENT_RECORD_COUNT) << EVENT_RECORD_SEQ_POS) & EVENT_RECORD_SEQ_MASK;
+    info = EventBuffer[committed & (EVENT_RECORD_COUNT - 1U)].info;
+    if ((info & (EVENT_RECORD_VALID | EVENT_RECORD_LOCKED | EVENT_RECORD_SEQ_MASK)) != (EVENT_RECORD_VALID | seq)) {
+      // Record is not written yet
+      break;
+    }
+    // Failed exchange: committed is updated to the index advanced by an interrupting writer
+    if (atomic_cmp_xch_32(&EventStatus.record_committed, &committed, committed + 1U) != 0U) {
+      committed++;
+    }
+  }
 }
 
-__STATIC_INLINE void UnlockRecord (uint32_t *mem, uint32_t info) {
-  uint32_t val;
+#else
 
-  __COMPILER_BARRIER();
-  val = info & ~EVENT_RECORD_LOCKED;
-  *mem = val;
+__STATIC_INLINE void EventRecordBegin (void) {
 }
 
-#else /* (__CORTEX_M >= 3U) */
+__STATIC_INLINE void EventRecordCommit (void) {
+}
 
-__STATIC_INLINE uint32_t LockRecord (uint32_t *mem, uint32_t info) {
-  uint32_t val;
-  uint32_t val_new;
- 
-  val = *mem;
+#endif
+
+#if (EVENT_BUFFER_MODE != 0)
+
+/**
+  Get record index when free records are available (unread records are not overwritten)
+  \param[out]   index  record index
+  \param[in]    num    number of free records required
+  \return       1=Success, 0=Buffer full
+*/
+__STATIC_INLINE uint32_t GetFreeRecordIndex (uint32_t *index, uint32_t num) {
+  uint32_t i;
+
+  i = EventStatus.record_index;
   do {
-    if ((val & EVENT_RECORD_LOCKED) != 0U) {
+    if (((i - EventStatus.records_read) + num) > EVENT_RECORD_COUNT) {
       //lint -e{904} "Return statement before end of function"
       return 0U;
     }
-    val_new = (info | EVENT_RECORD_LOCKED) |
-              (val  & EVENT_RECORD_TBIT);
-  } while (!atomic_compare_exchange_weak_explicit((_Atomic uint32_t *)mem,
-                                                  &val,
-                                                  val_new,
-                                                  memory_order_acquire,
-                                                  memory_order_relaxed));
- 
-  return val_new;
-}
+  } while (atomic_cmp_xch_32(&EventStatus.record_index, &i, i + 1U) == 0U);
+  *index = i;
 
-__STATIC_INLINE void UnlockRecord (uint32_t *mem, uint32_t info) {
-  uint32_t val;
- 
-  val = info & ~EVENT_RECORD_LOCKED;
-  (void)atomic_exchange_explicit((_Atomic uint32_t *)mem, val, memory_order_release);
+  return 1U;
+}
+
+/**
+  Reject event because the event buffer is full (Drop new events or Stop recording)
+*/
+static void EventBufferFull (void) {
+  (void)atomic_inc_32(&EventStatus.events_rejected);
+#if (EVENT_BUFFER_MODE == 2)
+  EventStatus.state = 0U;
+#endif
+}
+
+#endif
+
+#if (EVENT_WATERMARK != 0)
+
+/**
+  Notify crossing of a fill-level watermark (exactly once per crossing)
+  \param[in]    state  expected watermark state (0=below High Watermark, 1=High Watermark reached)
+*/
+static void EventWatermarkCross (uint32_t state) {
+  //lint --e{934} "Taking address of near auto variable"
+  uint32_t event;
+
+  if (atomic_cmp_xch_32(&WatermarkState, &state, state ^ 1U) == 0U) {
+    // Crossing already notified by an interrupting record function or consumer
+    //lint -e{904} "Return statement before end of function"
+    return;
+  }
+  event = (state == 0U) ? EventWatermarkHigh : EventWatermarkLow;
+  atomic_or_32(&WatermarkPending, event);
+  EventRecorderWatermark(event);
+}
+
+/**
+  Check number of unread records against fill-level watermarks
+*/
+__STATIC_INLINE void EventWatermarkCheck (void) {
+  uint32_t unread;
+  uint32_t state;
+
+  unread = EventStatus.record_index - EventStatus.records_read;
+  state  = WatermarkState;
+  if (state == 0U) {
+    if (unread >= EVENT_WATERMARK_HIGH) {
+      EventWatermarkCross(state);
+    }
+  } else {
+    if (unread <= EVENT_WATERMARK_LOW) {
+      EventWatermarkCross(state);
+    }
+  }
+}
+
+#else
+
+__STATIC_INLINE void EventWatermarkCheck (void) {
+}
+
+#endif
+
+
+#if (__CORTEX_M < 3U)
+
+__STATIC_INLINE uint32_t LockRecord (uint32_t *mem, uint32_t info) {
+  uint32_t primask = __get_PRIMASK();
+  uint32_t masked;
+  uint32_t val;
+
+  __disable_irq();
+  masked = EventProfileMaskStart();
+  val = *mem;
+  if ((val & EVENT_RECORD_LOCKED) == 0U) {
+     val = (info | EVENT_RECORD_LOCKED) |
+           (val  & EVENT_RECORD_TBIT);
+    *mem = val;
+  } else {
+     val = 0U;
+  }
+  EventProfileMaskEnd(masked);
+  if (primask == 0U) {
+    __enable_irq();
+  }
+  __COMPILER_BARRIER();
+
+  return val;
+}
+
+__STATIC_INLINE void UnlockRecord (uint32_t *mem, uint32_t info) {
+  uint32_t val;
+
+  __COMPILER_BARRIER();
+  val = info & ~EVENT_RECORD_LOCKED;
+  *mem = val;
+}
+
+#else /* (__CORTEX_M >= 3U) */
+
+__STATIC_INLINE uint32_t LockRecord (uint32_t *mem, uint32_t info) {
+  uint32_t val;
+  uint32_t val_new;
+ 
+  val = *mem;
+  do {
+    if ((val & EVENT_RECORD_LOCKED) != 0U) {
+      //lint -e{904} "Return statement before end of function"
+      return 0U;
+    }
+    val_new = (info | EVENT_RECORD_LOCKED) |
+              (val  & EVENT_RECORD_TBIT);
+  } while (!atomic_compare_exchange_weak_explicit((_Atomic uint32_t *)mem,
+                                                  &val,
+                                                  val_new,
+                                                  memory_order_acquire,
+                                                  memory_order_relaxed));
+ 
+  return val_new;
+}
+
+__STATIC_INLINE void UnlockRecord (uint32_t *mem, uint32_t info) {
+  uint32_t val;
+ 
+  val = info & ~EVENT_RECORD_LOCKED;
+  (void)atomic_exchange_explicit((_Atomic uint32_t *)mem, val, memory_order_release);
 }
 
 #endif
@@ -488,18 +1219,297 @@ static int32_t sys_write (FILEHANDLE fh, const uint8_t *buf, uint32_t len) {
   return semihosting_call(SYS_WRITE, &args);
 }
 
+#if (EVENT_LOG_COMPRESSION != 0)
+
+/**
+  Compress event data (LZ77 with short window, no dictionary)
+  Output is a sequence of tokens:
+   - 0x00..0x7F, followed by n+1 literal bytes
+   - 0x80..0xFF, followed by length-3: repeat length bytes from distance (token & 0x7F) + 1
+  \param[out]   out    output buffer (len bytes)
+  \param[in]    data   event data buffer
+  \param[in]    len    event data length
+  \return       compressed length (0 = data not compressible)
+*/
+static uint32_t EventCompress (uint8_t *out, const uint8_t *data, uint32_t len) {
+  uint32_t i, o, lit;
+  uint32_t d, n;
+  uint32_t best_d, best_n;
+
+  i   = 0U;
+  o   = 0U;
+  lit = 0U;
+  while (i < len) {
+    best_d = 0U;
+    best_n = 0U;
+    for (d = 1U; (d <= EVENT_LOG_COMPRESS_WINDOW) && (d <= i); d++) {
+      n = 0U;
+      while (((i + n) < len) && (n < 258U) && (data[i + n] == data[i + n - d])) {
+        n++;
+      }
+      if (n > best_n) {
+        best_n = n;
+        best_d = d;
+      }
+    }
+    if ((best_n < 3U) && ((i - lit) < 128U)) {
+      i++;
+      continue;
+    }
+    if (i != lit) {
+      n = i - lit;
+      if ((o + 1U + n) >= len) {
+        //lint -e{904} "Return statement before end of function"
+        return 0U;
+      }
+      out[o++] = (uint8_t)(n - 1U);
+      memcpy(&out[o], &data[lit], n);
+      o += n;
+    }
+    if (best_n >= 3U) {
+      if ((o + 2U) >= len) {
+        //lint -e{904} "Return statement before end of function"
+        return 0U;
+      }
+      out[o++] = (uint8_t)(0x80U | (best_d - 1U));
+      out[o++] = (uint8_t)(best_n - 3U);
+      i += best_n;
+    }
+    lit = i;
+  }
+  if (i != lit) {
+    n = i - lit;
+    if ((o + 1U + n) >= len) {
+      //lint -e{904} "Return statement before end of function"
+      return 0U;
+    }
+    out[o++] = (uint8_t)(n - 1U);
+    memcpy(&out[o], &data[lit], n);
+    o += n;
+  }
+
+  return (o);
+}
+
+/**
+  Write an event with data to a log file (compress data if possible)
+  \param[in]    event      event buffer with header (space for len data bytes after header)
+  \param[in]    head_len   event header length (including EventRecordHead_t)
+  \param[in]    data       event data buffer
+  \param[in]    len        event data length
+*/
+static void EventWriteData_Log (uint8_t *event, uint32_t head_len, const uint8_t *data, uint32_t len) {
+  //lint --e{826} "Suspicious pointer-to-pointer conversion (area too small)"
+  EventRecordHead_t *head = (EventRecordHead_t *)event;
+  uint32_t n;
+
+  n = EventCompress(&event[head_len], data, len);
+  if (n != 0U) {
+    head->type   |= EVENT_TYPE_COMPRESSED;
+    head->length  = (uint16_t)((head->length - len) + n);
+  } else {
+    memcpy(&event[head_len], data, len);
+    n = len;
+  }
+  (void)sys_write(FileHandle, event, head_len + n);
+}
+
+#endif
+
 #endif
 
 
+#if (EVENT_PROFILING != 0)
+
 /**
-  Record a single item
+  Update Recorder Self-Profiling counters with a written record
+  \param[in]    id       event identifier of the record
+  \param[in]    ts       timestamp of the event (taken when the record function was entered)
+  \param[in]    retries  number of lock retries (0..EVENT_RECORD_MAX_LOCKED-1)
+*/
+static void EventProfileItem (uint32_t id, uint32_t ts, uint32_t retries) {
+  //lint --e{934} "Taking address of near auto variable"
+  uint32_t bucket;
+  uint32_t period;
+  uint32_t start;
+  uint32_t count;
+  uint32_t time;
+
+  if (retries < 2U) {
+    bucket = retries;
+  } else {
+    bucket = (retries < 4U) ? 2U : 3U;
+  }
+  (void)atomic_inc_32(&EventProfile.retries[bucket]);
+
+  if ((id & EVENT_RECORD_LAST) == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return;
+  }
+
+  // Last record of an event: time from event timestamp until the event is complete
+  time = EventRecorderTimerGetCount() - ts;
+  (void)atomic_inc_32(&EventProfile.events);
+  if (atomic_add_32(&EventProfile.time_lo, time) > (0xFFFFFFFFU - time)) {
+    (void)atomic_inc_32(&EventProfile.time_hi);
+  }
+
+  // Peak event rate (approximate when events are recorded concurrently on period change)
+  period = EventStatus.ts_freq / 1000U;
+  if (period == 0U) {
+    period = 1U;
+  }
+  start = EventProfile.rate_ts;
+  if ((ts - start) >= period) {
+    if (atomic_cmp_xch_32(&EventProfile.rate_ts, &start, ts) != 0U) {
+      EventProfile.rate_count = 0U;
+    }
+  }
+  count = atomic_inc_32(&EventProfile.rate_count) + 1U;
+  start = EventProfile.rate_max;
+  while ((count > start) && (atomic_cmp_xch_32(&EventProfile.rate_max, &start, count) == 0U)) {
+    ;
+  }
+}
+
+#else
+
+__STATIC_INLINE void EventProfileItem (uint32_t id, uint32_t ts, uint32_t retries) {
+  (void)id;
+  (void)ts;
+  (void)retries;
+}
+
+#endif
+
+#if (EVENT_ITM != 0)
+
+/**
+  Wait until an ITM stimulus port accepts a word
+  \param[in]    port   stimulus port
+  \return       1=Ready, 0=Timeout (ITM FIFO not drained by the trace port)
+*/
+__STATIC_INLINE uint32_t EventWaitITM (uint32_t port) {
+  uint32_t cnt;
+
+  for (cnt = EVENT_ITM_WAIT; cnt != 0U; cnt--) {
+    if (ITM->PORT[port].u32 != 0U) {
+      //lint -e{904} "Return statement before end of function"
+      return 1U;
+    }
+  }
+  return 0U;
+}
+
+/**
+  Write a record to the ITM stimulus ports (first word on EVENT_ITM_PORT, values on EVENT_ITM_PORT+1)
+  \param[in]    info   record information (event identifier with flags)
+  \param[in]    ts     timestamp
+  \param[in]    val1   first data value
+  \param[in]    val2   second data value
+  \return       1=Success, 0=Timeout (record is incomplete)
+*/
+static uint32_t EventWriteITM (uint32_t info, uint32_t ts, uint32_t val1, uint32_t val2) {
+  uint32_t val[4];
+  uint32_t port;
+  uint32_t n;
+
+  val[0] = info;
+  val[1] = ts;
+  val[2] = val1;
+  val[3] = val2;
+  port   = EVENT_ITM_PORT;
+  for (n = 0U; n < 4U; n++) {
+    if (EventWaitITM(port) == 0U) {
+      //lint -e{904} "Return statement before end of function"
+      return 0U;
+    }
+    ITM->PORT[port].u32 = val[n];
+    port = EVENT_ITM_PORT + 1U;
+  }
+  return 1U;
+}
+
+/**
+  Stream a single item through ITM (first word on EVENT_ITM_PORT, values on EVENT_ITM_PORT+1)
+  \param[in]    id     event identifier (component, message with context & first/last flags)
+  \param[in]    ts     timestamp
+  \param[in]    val1   first data value
+  \param[in]    val2   second data value
+  \param[in]    thread thread index of the first item of an event in thread mode, EVENT_THREAD_NONE otherwise
+*/
+static void EventRecordItem_ITM (uint32_t id, uint32_t ts, uint32_t val1, uint32_t val2, uint32_t thread) {
+  uint32_t primask;
+  uint32_t masked;
+  uint32_t ret;
+
+  // Stimulus ports must be enabled by the debugger
+  if (((ITM->TCR & ITM_TCR_ITMENA_Msk) == 0U) ||
+      ((ITM->TER & (3UL << EVENT_ITM_PORT)) != (3UL << EVENT_ITM_PORT))) {
+    //lint -e{904} "Return statement before end of function"
+    return;
+  }
+
+  // Item is dropped without masking interrupts when the trace port does not drain the ITM FIFO
+  if (EventWaitITM(EVENT_ITM_PORT) == 0U) {
+    (void)atomic_inc_32(&EventStatus.events_rejected);
+    //lint -e{904} "Return statement before end of function"
+    return;
+  }
+
+  // Words of a record are not interleaved with records of interrupts
+  primask = __get_PRIMASK();
+  __disable_irq();
+  masked = EventProfileMaskStart();
+  ret = 1U;
+#if (EVENT_THREAD_TAGGING != 0)
+  // Thread switch is streamed with the item (the ITM stream is ordered by the masked interrupts)
+  if ((thread != EVENT_THREAD_NONE) && (thread != EventThreadLastITM)) {
+    ret = EventWriteITM(ID_EVENT_THREAD | EVENT_RECORD_VALID, ts, thread, 0U);
+    if (ret != 0U) {
+      EventThreadLastITM = thread;
+    }
+  }
+#else
+  (void)thread;
+#endif
+  if (ret != 0U) {
+    ret = EventWriteITM(id | EVENT_RECORD_VALID, ts, val1, val2);
+  }
+  EventProfileMaskEnd(masked);
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  // Incomplete record is discarded by the decoder
+  if (ret == 0U) {
+    (void)atomic_inc_32(&EventStatus.events_rejected);
+  }
+}
+
+#else
+
+__STATIC_INLINE void EventRecordItem_ITM (uint32_t id, uint32_t ts, uint32_t val1, uint32_t val2, uint32_t thread) {
+  (void)id;
+  (void)ts;
+  (void)val1;
+  (void)val2;
+  (void)thread;
+}
+
+#endif
+
+#if (EVENT_PARTITION != 0)
+
+/**
+  Record a single item in the Reserved Partition
   \param[in]    id     event identifier (component, message with context & first/last flags)
   \param[in]    ts     timestamp
   \param[in]    val1   first data value
   \param[in]    val2   second data value
   \return       status (1=Success, 0=Failure)
 */
-static uint32_t EventRecordItem (uint32_t id, uint32_t ts, uint32_t val1, uint32_t val2) {
+static uint32_t EventRecordItemReserved (uint32_t id, uint32_t ts, uint32_t val1, uint32_t val2) {
   EventRecord_t *record;
   uint32_t cnt, i;
   uint32_t info;
@@ -507,9 +1517,9 @@ static uint32_t EventRecordItem (uint32_t id, uint32_t ts, uint32_t val1, uint32
   uint32_t seq;
 
   for (cnt = EVENT_RECORD_MAX_LOCKED; cnt != 0U; cnt--) {
-    i = GetRecordIndex();
-    record = &EventBuffer[i & (EVENT_RECORD_COUNT - 1U)];
-    seq  = ((i / EVENT_RECORD_COUNT) << EVENT_RECORD_SEQ_POS) & EVENT_RECORD_SEQ_MASK;
+    i = atomic_inc_32(&EventReservedIndex);
+    record = &EventBufferReserved[i & (EVENT_PARTITION_COUNT - 1U)];
+    seq  = ((i / EVENT_PARTITION_COUNT) << EVENT_RECORD_SEQ_POS) & EVENT_RECORD_SEQ_MASK;
     info = id                                    |
            seq                                   |
            ((ts   >> 3) & EVENT_RECORD_MSB_TS)   |
@@ -523,8 +1533,11 @@ static uint32_t EventRecordItem (uint32_t id, uint32_t ts, uint32_t val1, uint32
       record->ts   = (ts   & ~EVENT_RECORD_TBIT) | tbit;
       record->val1 = (val1 & ~EVENT_RECORD_TBIT) | tbit;
       record->val2 = (val2 & ~EVENT_RECORD_TBIT) | tbit;
+      // Position of the record within the records of the Event Buffer
+      EventReservedSeq[i & (EVENT_PARTITION_COUNT - 1U)] = EventStatus.record_index;
       UnlockRecord(&record->info, info);
       IncrementRecordsWritten();
+      EventProfileItem(id, ts, EVENT_RECORD_MAX_LOCKED - cnt);
       //lint -e{904} "Return statement before end of function"
       return 1U;
     }
@@ -534,52 +1547,425 @@ static uint32_t EventRecordItem (uint32_t id, uint32_t ts, uint32_t val1, uint32
   return 0U;
 }
 
-
-#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+#endif
 
 /**
-  Record an event with variable data size to a log file
-  \param[in]    id     event identifier (component number, message number)
-  \param[in]    data   event data buffer
-  \param[in]    len    event data length
-  \param[in]    ts     timestamp
+  Select partition of an event by level and component
+  \param[in]    id     event identifier (level, component number, message number)
+  \return       EVENT_RECORD_PART for the Reserved Partition, 0 for the Event Buffer
 */
-static void EventRecordData_Log (uint32_t id,
-                                 const void *data, uint32_t len,
-                                 uint64_t ts) {
-  //lint --e{934} "Taking address of near auto variable"
-  struct {
-    EventRecordHead_t head;
-    EventRecordData_t record;
-  } event;
-
-  event.head.type          = EVENT_TYPE_DATA;
-  event.head.length        = (uint16_t)(sizeof(event.record) + len);
-  event.record.ts          = ts;
-  event.record.info.id     = (uint16_t)id;
-  //lint -e{9034} "Expression assigned to a narrower or different essential type"
-  event.record.info.length = len;
-  event.record.info.irq    = (__get_IPSR() != 0U) ? 1U : 0U;
+__STATIC_INLINE uint32_t EventPartition (uint32_t id) {
+#if (EVENT_PARTITION != 0)
+  uint32_t comp;
 
-  (void)sys_write(FileHandle, (uint8_t *)&event,  sizeof(event));
-  //lint -e{9079} "conversion from pointer to void to pointer to other type"
-  (void)sys_write(FileHandle,             data,   len);
+  comp = (id >> 8) & 0xFFU;
+  if ((((EVENT_PARTITION_LEVEL >> ((id >> 16) & 3U)) & 1U) != 0U) ||
+      ((comp >= EVENT_PARTITION_COMP_FIRST) && (comp <= EVENT_PARTITION_COMP_LAST))) {
+    //lint -e{904} "Return statement before end of function"
+    return EVENT_RECORD_PART;
+  }
+#else
+  (void)id;
+#endif
+  return 0U;
 }
 
 /**
-  Record an event with two 32-bit data values to a log file
-  \param[in]    id     event identifier (component number, message number)
+  Write a single item to a reserved record of the Event Buffer
+  \param[in]    i      record index
+  \param[in]    id     event identifier (component, message with context & first/last flags)
+  \param[in]    ts     timestamp
   \param[in]    val1   first data value
   \param[in]    val2   second data value
-  \param[in]    ts     timestamp
+  \return       status (1=Success, 0=Record locked by another writer)
 */
-static void EventRecord2_Log (uint32_t id,
-                              uint32_t val1, uint32_t val2,
-                              uint64_t ts) {
-  //lint --e{934} "Taking address of near auto variable"
-  struct {
-    EventRecordHead_t head;
-    EventRecord2_t    record;
+static uint32_t EventWriteRecord (uint32_t i, uint32_t id, uint32_t ts, uint32_t val1, uint32_t val2) {
+  EventRecord_t *record;
+  uint32_t info;
+  uint32_t tbit;
+  uint32_t seq;
+
+  record = &EventBuffer[i & (EVENT_RECORD_COUNT - 1U)];
+#if (EVENT_LAZY_INIT != 0)
+  // Record is not used by another writer in the first pass after initialization:
+  // lock of a write interrupted by reset or random content after power-on is released
+  if ((i - EventStatus.record_start) < EVENT_RECORD_COUNT) {
+    record->info &= ~EVENT_RECORD_LOCKED;
+  }
+#endif
+  seq  = ((i / EVENT_RECORD_COUNT) << EVENT_RECORD_SEQ_POS) & EVENT_RECORD_SEQ_MASK;
+  info = id                                    |
+         seq                                   |
+         ((ts   >> 3) & EVENT_RECORD_MSB_TS)   |
+         ((val1 >> 2) & EVENT_RECORD_MSB_VAL1) |
+         ((val2 >> 1) & EVENT_RECORD_MSB_VAL2) |
+         EVENT_RECORD_VALID;
+  info = LockRecord(&record->info, info);
+  if ((info & EVENT_RECORD_LOCKED) == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+  info ^= EVENT_RECORD_TBIT;
+  tbit  = info & EVENT_RECORD_TBIT;
+  record->ts   = (ts   & ~EVENT_RECORD_TBIT) | tbit;
+  record->val1 = (val1 & ~EVENT_RECORD_TBIT) | tbit;
+  record->val2 = (val2 & ~EVENT_RECORD_TBIT) | tbit;
+  UnlockRecord(&record->info, info);
+  IncrementRecordsWritten();
+
+  return 1U;
+}
+
+#if (EVENT_THREAD_TAGGING != 0)
+
+/**
+  Get record index of the first item of an event in thread mode and record a thread switch
+  when the thread differs from the last recorded thread
+  \param[out]   index  record index
+  \param[in]    num    number of free records required (0 for an item of the Reserved Partition)
+  \param[in]    thread thread index
+  \param[in]    ts     timestamp
+  \return       1=Success, 0=Buffer full
+  \note         Interrupts are masked only to reserve the records of a thread switch and the item:
+                the last recorded thread is updated together with the record index.
+*/
+static uint32_t GetThreadRecordIndex (uint32_t *index, uint32_t num, uint32_t thread, uint32_t ts) {
+  //lint --e{934} "Taking address of near auto variable"
+  uint32_t primask;
+  uint32_t masked;
+  uint32_t ret;
+  uint32_t i;
+
+  i = EventStatus.record_index;
+  while (thread == EventThreadLast) {
+    if (num == 0U) {
+      // Item of the Reserved Partition: no record is reserved in the Event Buffer
+      //lint -e{904} "Return statement before end of function"
+      return 1U;
+    }
+#if (EVENT_BUFFER_MODE != 0)
+    if (((i - EventStatus.records_read) + num) > EVENT_RECORD_COUNT) {
+      //lint -e{904} "Return statement before end of function"
+      return 0U;
+    }
+#endif
+    // Failed exchange: a thread switch or item was recorded since the check (check is repeated)
+    if (atomic_cmp_xch_32(&EventStatus.record_index, &i, i + 1U) != 0U) {
+      *index = i;
+      //lint -e{904} "Return statement before end of function"
+      return 1U;
+    }
+  }
+
+  // Records of the thread switch and the item are reserved with masked interrupts
+  primask = __get_PRIMASK();
+  __disable_irq();
+  masked = EventProfileMaskStart();
+  i   = EventStatus.record_index;
+  ret = 1U;
+#if (EVENT_BUFFER_MODE != 0)
+  if (((i - EventStatus.records_read) + num + 1U) > EVENT_RECORD_COUNT) {
+    ret = 0U;
+  }
+#endif
+  if (ret != 0U) {
+    (void)atomic_add_32(&EventStatus.record_index, (num != 0U) ? 2U : 1U);
+    EventThreadLast = thread;
+  }
+  EventProfileMaskEnd(masked);
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  if (ret != 0U) {
+    if (EventWriteRecord(i, ID_EVENT_THREAD, ts, thread, 0U) == 0U) {
+      IncrementRecordsDumped();
+    }
+    *index = i + 1U;
+  }
+
+  return (ret);
+}
+
+#endif
+
+/**
+  Get record index of an item
+  \param[out]   index  record index
+  \param[in]    num    number of free records required (buffer mode)
+  \param[in]    thread thread index of the first item of an event in thread mode, EVENT_THREAD_NONE otherwise
+  \param[in]    ts     timestamp of the thread switch
+  \return       1=Success, 0=Buffer full
+*/
+__STATIC_INLINE uint32_t GetItemRecordIndex (uint32_t *index, uint32_t num, uint32_t thread, uint32_t ts) {
+#if (EVENT_THREAD_TAGGING != 0)
+  if (thread != EVENT_THREAD_NONE) {
+    //lint -e{904} "Return statement before end of function"
+    return (GetThreadRecordIndex(index, num, thread, ts));
+  }
+#else
+  (void)thread;
+  (void)ts;
+#endif
+#if (EVENT_BUFFER_MODE != 0)
+  return (GetFreeRecordIndex(index, num));
+#else
+  (void)num;
+  *index = GetRecordIndex();
+  return 1U;
+#endif
+}
+
+/**
+  Record a single item
+  \param[in]    id     event identifier (component, message with context & first/last flags)
+  \param[in]    ts     timestamp
+  \param[in]    val1   first data value
+  \param[in]    val2   second data value
+  \param[in]    thread thread index of the first item of an event, EVENT_THREAD_NONE for subsequent items
+  \return       status (1=Success, 0=Failure)
+  \note         Thread Tagging: a thread switch is recorded before the first item of an event in thread mode
+                when the thread differs from the last recorded thread.
+*/
+static uint32_t EventRecordItemThread (uint32_t id, uint32_t ts, uint32_t val1, uint32_t val2, uint32_t thread) {
+  //lint --e{934} "Taking address of near auto variable"
+  uint32_t cnt, i;
+  uint32_t num;
+
+#if (EVENT_THREAD_TAGGING != 0)
+  // Events of interrupts are marked with the IRQ flag and do not switch the thread
+  if ((id & EVENT_RECORD_IRQ) != 0U) {
+    //lint -e{9044} "function parameter modified"
+    thread = EVENT_THREAD_NONE;
+  }
+#endif
+
+  EventRecordItem_ITM(id & ~EVENT_RECORD_PART, ts, val1, val2, thread);
+
+#if (EVENT_PARTITION != 0)
+  if ((id & EVENT_RECORD_PART) != 0U) {
+#if (EVENT_THREAD_TAGGING != 0)
+    if (thread != EVENT_THREAD_NONE) {
+      // Thread switch is recorded in the Event Buffer
+      EventRecordBegin();
+      (void)GetThreadRecordIndex(&i, 0U, thread, ts);
+      EventRecordCommit();
+    }
+#endif
+    //lint -e{904} "Return statement before end of function"
+    return (EventRecordItemReserved(id & ~EVENT_RECORD_PART, ts, val1, val2));
+  }
+#endif
+
+  EventRecordBegin();
+
+  // First record of an event with two records requires space for both
+  num = ((id & (EVENT_RECORD_FIRST | EVENT_RECORD_LAST)) == EVENT_RECORD_FIRST) ? 2U : 1U;
+
+  for (cnt = EVENT_RECORD_MAX_LOCKED; cnt != 0U; cnt--) {
+#if (EVENT_BUFFER_MODE != 0)
+    if (GetItemRecordIndex(&i, num, thread, ts) == 0U) {
+      EventRecordCommit();
+      EventBufferFull();
+      //lint -e{904} "Return statement before end of function"
+      return 0U;
+    }
+#else
+    (void)GetItemRecordIndex(&i, num, thread, ts);
+#endif
+    if (EventWriteRecord(i, id, ts, val1, val2) != 0U) {
+      EventRecordCommit();
+      EventProfileItem(id, ts, EVENT_RECORD_MAX_LOCKED - cnt);
+      if ((id & EVENT_RECORD_LAST) != 0U) {
+        EventWatermarkCheck();
+      }
+      //lint -e{904} "Return statement before end of function"
+      return 1U;
+    }
+  }
+
+  IncrementRecordsDumped();
+  EventRecordCommit();
+  return 0U;
+}
+
+/**
+  Record a single item (subsequent item of an event or item without thread switch)
+  \param[in]    id     event identifier (component, message with context & first/last flags)
+  \param[in]    ts     timestamp
+  \param[in]    val1   first data value
+  \param[in]    val2   second data value
+  \return       status (1=Success, 0=Failure)
+*/
+__STATIC_INLINE uint32_t EventRecordItem (uint32_t id, uint32_t ts, uint32_t val1, uint32_t val2) {
+  return (EventRecordItemThread(id, ts, val1, val2, EVENT_THREAD_NONE));
+}
+
+/**
+  Record a chain of items (first item with values followed by items with data)
+  \param[in]    id     event identifier (component, message with IRQ flag)
+  \param[in]    ts     timestamp
+  \param[in]    val1   first data value of first item
+  \param[in]    val2   second data value of first item
+  \param[in]    data   data buffer for subsequent items
+  \param[in]    len    data length (1..EVENT_DATA_MAX_LENGTH-8)
+  \param[in]    thread thread index (thread switch before the first item), EVENT_THREAD_NONE for no switch
+  \return       status (1=Success, 0=Failure)
+*/
+static uint32_t EventRecordChain (uint32_t id, uint32_t ts,
+                                  uint32_t val1, uint32_t val2,
+                                  const uint8_t *data, uint32_t len, uint32_t thread) {
+  //lint --e{934}  "Taking address of near auto variable"
+  //lint --e{9016} "pointer arithmetic other than array indexing used"
+  uint32_t ctx;
+  uint32_t val[2];
+  uint32_t ret;
+
+#if (EVENT_BUFFER_MODE != 0)
+  // Event is rejected when the event buffer has no space for all records
+  if (((id & EVENT_RECORD_PART) == 0U) &&
+      (((EventStatus.record_index - EventStatus.records_read) + 1U + ((len + 7U) / 8U)) > EVENT_RECORD_COUNT)) {
+    EventBufferFull();
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+#endif
+
+  ctx = (GetContext() << EVENT_RECORD_CTX_POS) & EVENT_RECORD_CTX_MASK;
+
+  id |= ctx;
+  ret = EventRecordItemThread(id | EVENT_RECORD_FIRST, ts, val1, val2, thread);
+  if (ret == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+
+  //lint -e{9044} "function parameter modified"
+  id = 0xFF01U | ctx | (id & EVENT_RECORD_PART);
+
+  while (len > 8U) {
+    memcpy(val, data, 8U);
+    data += 8U;
+    len  -= 8U;
+    ret = EventRecordItem(id, ts, val[0], val[1]);
+    id++;
+    if (ret == 0U) {
+      //lint -e{904} "Return statement before end of function"
+      return 0U;
+    }
+  }
+
+  val[0] = 0U;
+  val[1] = 0U;
+  memcpy(val, data, len);
+  id &= ~0xFF00U;
+  id |= len << 8;
+  ret = EventRecordItem(id | EVENT_RECORD_LAST, ts, val[0], val[1]);
+
+  return (ret);
+}
+
+
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+
+/**
+  Record an event with variable data size to a log file
+  \param[in]    id     event identifier (component number, message number, thread index)
+  \param[in]    data   event data buffer
+  \param[in]    len    event data length
+  \param[in]    ts     timestamp
+*/
+static void EventRecordData_Log (uint32_t id,
+                                 const void *data, uint32_t len,
+                                 uint64_t ts) {
+  //lint --e{934} "Taking address of near auto variable"
+  struct {
+    EventRecordHead_t head;
+    EventRecordData_t record;
+#if (EVENT_LOG_COMPRESSION != 0)
+    uint8_t           data[EVENT_DATA_MAX_LENGTH];
+#endif
+  } event;
+
+  event.head.type          = EVENT_TYPE_DATA;
+  event.head.length        = (uint16_t)(sizeof(event.record) + len);
+  event.record.ts          = ts;
+  event.record.info.id     = (uint16_t)id;
+  //lint -e{9034} "Expression assigned to a narrower or different essential type"
+  event.record.info.length = len;
+  event.record.info.thread = (id & EVENT_LOG_THREAD_MASK) >> EVENT_LOG_THREAD_POS;
+  event.record.info.irq    = (__get_IPSR() != 0U) ? 1U : 0U;
+
+#if (EVENT_LOG_COMPRESSION != 0)
+  //lint -e{9079} "conversion from pointer to void to pointer to other type"
+  EventWriteData_Log((uint8_t *)&event, sizeof(event.head) + sizeof(event.record), data, len);
+#else
+  (void)sys_write(FileHandle, (uint8_t *)&event,  sizeof(event));
+  //lint -e{9079} "conversion from pointer to void to pointer to other type"
+  (void)sys_write(FileHandle,             data,   len);
+#endif
+}
+
+/**
+  Record a fragment of an event with large data size to a log file
+  \param[in]    id     event identifier (component number, message number, thread index)
+  \param[in]    xfer   transfer identifier
+  \param[in]    total  total length of event data
+  \param[in]    offset offset of fragment data within event data
+  \param[in]    data   fragment data buffer
+  \param[in]    len    fragment data length
+  \param[in]    ts     timestamp
+*/
+static void EventRecordFrag_Log (uint32_t id,
+                                 uint32_t xfer, uint32_t total, uint32_t offset,
+                                 const void *data, uint32_t len,
+                                 uint64_t ts) {
+  //lint --e{934} "Taking address of near auto variable"
+  struct {
+    EventRecordHead_t head;
+    EventRecordData_t record;
+    EventRecordFrag_t frag;
+#if (EVENT_LOG_COMPRESSION != 0)
+    uint8_t           data[EVENT_FRAG_MAX_LENGTH];
+#endif
+  } event;
+
+  event.head.type          = EVENT_TYPE_FRAG;
+  event.head.length        = (uint16_t)(sizeof(event.record) + sizeof(event.frag) + len);
+  event.record.ts          = ts;
+  event.record.info.id     = (uint16_t)id;
+  //lint -e{9034} "Expression assigned to a narrower or different essential type"
+  event.record.info.length = sizeof(event.frag) + len;
+  event.record.info.thread = (id & EVENT_LOG_THREAD_MASK) >> EVENT_LOG_THREAD_POS;
+  event.record.info.irq    = (__get_IPSR() != 0U) ? 1U : 0U;
+  event.frag.xfer          = (uint16_t)xfer;
+  event.frag.total         = (uint16_t)total;
+  event.frag.offset        = offset;
+
+#if (EVENT_LOG_COMPRESSION != 0)
+  //lint -e{9079} "conversion from pointer to void to pointer to other type"
+  EventWriteData_Log((uint8_t *)&event, sizeof(event.head) + sizeof(event.record) + sizeof(event.frag), data, len);
+#else
+  (void)sys_write(FileHandle, (uint8_t *)&event,  sizeof(event));
+  //lint -e{9079} "conversion from pointer to void to pointer to other type"
+  (void)sys_write(FileHandle,             data,   len);
+#endif
+}
+
+/**
+  Record an event with two 32-bit data values to a log file
+  \param[in]    id     event identifier (component number, message number, thread index)
+  \param[in]    val1   first data value
+  \param[in]    val2   second data value
+  \param[in]    ts     timestamp
+*/
+static void EventRecord2_Log (uint32_t id,
+                              uint32_t val1, uint32_t val2,
+                              uint64_t ts) {
+  //lint --e{934} "Taking address of near auto variable"
+  struct {
+    EventRecordHead_t head;
+    EventRecord2_t    record;
   } event;
 
   event.head.type          = EVENT_TYPE_VAL2;
@@ -587,6 +1973,7 @@ static void EventRecord2_Log (uint32_t id,
   event.record.ts          = ts;
   event.record.info.id     = (uint16_t)id;
   event.record.info.rsrvd  = 0U;
+  event.record.info.thread = (id & EVENT_LOG_THREAD_MASK) >> EVENT_LOG_THREAD_POS;
   event.record.info.irq    = (__get_IPSR() != 0U) ? 1U : 0U;
   event.record.val1        = val1;
   event.record.val2        = val2;
@@ -596,7 +1983,7 @@ static void EventRecord2_Log (uint32_t id,
 
 /**
   Record an event with four 32-bit data values a log file
-  \param[in]    id     event identifier (component number, message number)
+  \param[in]    id     event identifier (component number, message number, thread index)
   \param[in]    val1   first data value
   \param[in]    val2   second data value
   \param[in]    val3   third data value
@@ -617,6 +2004,7 @@ static void EventRecord4_Log (uint32_t id,
   event.record.ts          = ts;
   event.record.info.id     = (uint16_t)id;
   event.record.info.rsrvd  = 0U;
+  event.record.info.thread = (id & EVENT_LOG_THREAD_MASK) >> EVENT_LOG_THREAD_POS;
   event.record.info.irq    = (__get_IPSR() != 0U) ? 1U : 0U;
   event.record.val1        = val1;
   event.record.val2        = val2;
@@ -650,9 +2038,11 @@ static uint64_t EventGetTS64 (void) {
     ts = EventRecorderTimerGetCount();
     if (ts < ts_last) {
       uint32_t primask = __get_PRIMASK();
+      uint32_t masked;
       uint32_t ts_latest;
       uint32_t ts_updated;
       __disable_irq();
+      masked = EventProfileMaskStart();
       ts_latest = *((volatile uint32_t *)&EventStatus.ts_last);
       if (ts_latest == ts_last) {
         EventStatus.ts_last = ts;
@@ -662,6 +2052,7 @@ static uint64_t EventGetTS64 (void) {
       } else {
         ts_updated = 0U;
       }
+      EventProfileMaskEnd(masked);
       if (primask == 0U) {
         __enable_irq();
       }
@@ -694,9 +2085,11 @@ static uint32_t EventGetTS (void) {
     ts = EventRecorderTimerGetCount();
     if (ts < ts_last) {
       uint32_t primask = __get_PRIMASK();
+      uint32_t masked;
       uint32_t ts_latest;
       uint32_t ts_updated;
       __disable_irq();
+      masked = EventProfileMaskStart();
       ts_latest = *((volatile uint32_t *)&EventStatus.ts_last);
       if (ts_latest == ts_last) {
         EventStatus.ts_last = ts;
@@ -706,6 +2099,7 @@ static uint32_t EventGetTS (void) {
       } else {
         ts_updated = 0U;
       }
+      EventProfileMaskEnd(masked);
       if (primask == 0U) {
         __enable_irq();
       }
@@ -723,446 +2117,1688 @@ static uint32_t EventGetTS (void) {
 
 
 /**
-  Check event filter based on specified level and component
+  Get event filter mask for component range within a 32-bit filter word
+  \param[in]    n           word number within level (0..7)
+  \param[in]    comp_start  first component number of range
+  \param[in]    comp_end    last component number of range
+  \return                   filter word mask
+*/
+__STATIC_INLINE uint32_t EventFilterMask (uint32_t n, uint32_t comp_start, uint32_t comp_end) {
+  uint32_t mask;
+
+  mask = 0xFFFFFFFFU;
+  if (n == (comp_start >> 5)) {
+    mask &= 0xFFFFFFFFU << (comp_start & 0x1FU);
+  }
+  if (n == (comp_end >> 5)) {
+    mask &= 0xFFFFFFFFU >> (0x1FU - (comp_end & 0x1FU));
+  }
+#ifdef __ARM_BIG_ENDIAN
+  mask = __REV(mask);
+#endif
+  return (mask);
+}
+
+#if (EVENT_CONTROL != 0)
+
+/**
+  Check trigger and stop recording after the events that follow the trigger event
   \param[in]    id     event identifier (level, component number, message number)
-  \return              1=Enabled, 0=Disabled
+  \return              1=Enabled, 0=Disabled (recording stopped)
 */
-__STATIC_INLINE uint32_t EventCheckFilter (uint32_t id) {
+static uint32_t EventTriggerCheck (uint32_t id) {
+  uint32_t state;
+  uint32_t count;
   uint32_t ret;
 
-  if (EventStatus.state == 0U) {
-    ret = 0U;
-  } else {
-    ret = ((uint32_t)EventFilter[(id >> (8 + 3)) & 0x7FU] >> ((id >> 8) & 0x7U)) & 1U;
+  ret   = 1U;
+  state = EventTrigger.state;
+  if (state == EVENT_TRIGGER_ARMED) {
+    if ((id & 0x3FFFFU) == EventTrigger.id) {
+      (void)atomic_cmp_xch_32(&EventTrigger.state, &state, EVENT_TRIGGER_FIRED);
+    }
+  }
+  if (state == EVENT_TRIGGER_FIRED) {
+    count = EventTrigger.count;
+    while ((count != 0U) && (atomic_cmp_xch_32(&EventTrigger.count, &count, count - 1U) == 0U)) {
+      ;
+    }
+    if (count == 0U) {
+      ret = 0U;
+      if (atomic_cmp_xch_32(&EventTrigger.state, &state, EVENT_TRIGGER_OFF) != 0U) {
+        (void)EventRecorderStop();
+      }
+    }
   }
   return (ret);
 }
 
-
 /**
-  Calculate CRC16-CCITT (16-bit, polynom=0x1021, init_value=0xFFFF)
-  \param[in]    data  pointer to data
-  \param[in]    len   data length (in bytes)
-  \return             CRC16-CCITT value
+  Execute control command
+  \param[in]    cmd    command (EventControlLength bytes)
+  \return       status (1=Success, 0=Failure)
 */
-static uint16_t crc16_ccitt (const uint8_t *data, uint32_t len) {
-  uint16_t crc;
-  uint32_t n;
+static uint32_t EventControlExecute (const uint8_t *cmd) {
+  uint32_t arg;
+  uint32_t ret;
 
-  crc = 0xFFFFU;
-  while (len != 0U) {
-    //lint -e{9049} "increment/decrement operation combined with other operation"
-    crc ^= ((uint16_t)*data++ << 8);
-    for (n = 8U; n != 0U; n--) {
-      if ((crc & 0x8000U) != 0U) {
-        crc <<= 1;
-        crc  ^= 0x1021U;
+  arg = (uint32_t)cmd[4] | ((uint32_t)cmd[5] << 8) | ((uint32_t)cmd[6] << 16) | ((uint32_t)cmd[7] << 24);
+
+  switch (cmd[0]) {
+    case EventControlEnable:
+      ret = EventRecorderEnable(cmd[1], cmd[2], cmd[3]);
+      break;
+    case EventControlDisable:
+      ret = EventRecorderDisable(cmd[1], cmd[2], cmd[3]);
+      break;
+    case EventControlStart:
+      ret = EventRecorderStart();
+      break;
+    case EventControlStop:
+      ret = EventRecorderStop();
+      break;
+    case EventControlTrigger:
+      // Trigger is off while it is changed
+      EventTrigger.state = EVENT_TRIGGER_OFF;
+      __COMPILER_BARRIER();
+      EventTrigger.id    = arg & 0x3FFFFU;
+      EventTrigger.count = (uint32_t)cmd[1] | ((uint32_t)cmd[2] << 8);
+      __DMB();
+      EventTrigger.state = EVENT_TRIGGER_ARMED;
+      ret = 1U;
+      break;
+    case EventControlTriggerOff:
+      EventTrigger.state = EVENT_TRIGGER_OFF;
+      ret = 1U;
+      break;
+    case EventControlPeriod:
+#if (EVENT_STATISTICS != 0)
+      if (arg <= 3600000U) {
+        EventStatisticsPeriod = arg;
+        ret = 1U;
       } else {
-        crc <<= 1;
+        ret = 0U;
+      }
+#else
+      ret = 0U;
+#endif
+      break;
+    default:
+      ret = 0U;
+      break;
+  }
+
+  return (ret);
+}
+
+#endif
+
+/**
+  Check event filter based on specified level and component
+  \param[in]    id     event identifier (level, component number, message number)
+  \return              1=Enabled, 0=Disabled
+*/
+__STATIC_INLINE uint32_t EventCheckFilter (uint32_t id) {
+  uint32_t ret;
+
+  if (EventStatus.state == 0U) {
+    ret = 0U;
+  } else {
+    ret = ((uint32_t)((const uint8_t *)EventFilter)[(id >> (8 + 3)) & 0x7FU] >> ((id >> 8) & 0x7U)) & 1U;
+#if (EVENT_CONTROL != 0)
+    if ((ret != 0U) && (EventTrigger.state != EVENT_TRIGGER_OFF)) {
+      ret = EventTriggerCheck(id);
+    }
+#endif
+  }
+  return (ret);
+}
+
+#if (EVENT_PREDICATES != 0)
+
+/**
+  Check value predicates of an event
+  \param[in]    id     event identifier (level, component number, message number)
+  \param[in]    data   event values or event data
+  \param[in]    len    length of values or data in bytes
+  \return       1=record event, 0=event rejected by a predicate
+*/
+static uint32_t EventCheckPredicates (uint32_t id, const void *data, uint32_t len) {
+  const EventPredicate_t *pred;
+  uint32_t used;
+  uint32_t ofs;
+  uint32_t val;
+  uint32_t ret;
+  uint32_t n;
+
+  ret  = 1U;
+  used = EventPredicateUsed;
+  // Number of evaluated predicates is limited by the highest predicate in use
+  for (n = 0U; (used != 0U) && (ret != 0U); n++) {
+    pred = &EventPredicate[n];
+    ofs  = (uint32_t)pred->index * 4U;
+    if (((used & 1U) != 0U) && (((id ^ pred->id) & pred->id_mask) == 0U) && (ofs < len)) {
+      val = 0U;
+      //lint -e{9016} "pointer arithmetic other than array indexing used"
+      memcpy(&val, (const uint8_t *)data + ofs, ((len - ofs) > 4U) ? 4U : (len - ofs));
+      switch (pred->op) {
+        case EventPredicateEQ:      ret = (val == pred->value)         ? 1U : 0U; break;
+        case EventPredicateNE:      ret = (val != pred->value)         ? 1U : 0U; break;
+        case EventPredicateLT:      ret = (val <  pred->value)         ? 1U : 0U; break;
+        case EventPredicateLE:      ret = (val <= pred->value)         ? 1U : 0U; break;
+        case EventPredicateGT:      ret = (val >  pred->value)         ? 1U : 0U; break;
+        case EventPredicateGE:      ret = (val >= pred->value)         ? 1U : 0U; break;
+        case EventPredicateAnySet:  ret = ((val & pred->value) != 0U)  ? 1U : 0U; break;
+        case EventPredicateAllClr:  ret = ((val & pred->value) == 0U)  ? 1U : 0U; break;
+        default:                                                                  break;
       }
     }
-    len--;
+    used >>= 1;
   }
 
-  return (crc);
+  return (ret);
 }
 
+#endif
 
-#if   (EVENT_TIMESTAMP_SOURCE == 0)
-#if ((__CORTEX_M < 3U) || (__CORTEX_M == 23U))
-#ifndef _lint
-#warning "Invalid Time Stamp Source selected in EventRecorderConf.h!"
+/**
+  Check value predicates of an event that passed the event filter
+  \param[in]    id     event identifier (level, component number, message number)
+  \param[in]    data   event values or event data
+  \param[in]    len    length of values or data in bytes
+  \return       1=record event, 0=event rejected by a predicate
+*/
+__STATIC_INLINE uint32_t EventCheckValues (uint32_t id, const void *data, uint32_t len) {
+#if (EVENT_PREDICATES != 0)
+  if (EventPredicateUsed != 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return (EventCheckPredicates(id, data, len));
+  }
+#else
+  (void)id;
+  (void)data;
+  (void)len;
 #endif
-static uint32_t TimeStamp __NO_INIT;
+  return 1U;
+}
+
+
+#if (EVENT_THREAD_TAGGING != 0)
+
+/**
+  Add thread to Thread Table and record its thread index
+  \param[in]    thread_id   thread identifier
+  \return       thread index (1..EVENT_THREAD_MAX), 0=Table full
+*/
+static uint32_t EventThreadAdd (osThreadId_t thread_id) {
+  uint32_t name;
+  uint32_t tid;
+  uint32_t ctx;
+  uint32_t id;
+  uint32_t ts;
+  uint32_t val;
+  uint32_t n;
+
+  //lint -e{923} "cast from pointer to unsigned int"
+  tid = (uint32_t)thread_id;
+  for (n = 0U; n < EVENT_THREAD_MAX; n++) {
+    val = EventThreadTable[n];
+    if ((val == 0U) && (atomic_cmp_xch_32(&EventThreadTable[n], &val, tid) != 0U)) {
+      break;
+    }
+    if (val == tid) {
+      // Added concurrently
+      //lint -e{904} "Return statement before end of function"
+      return (n + 1U);
+    }
+  }
+  if (n == EVENT_THREAD_MAX) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+
+  // Record thread index with thread identifier and thread name
+  //lint -e{923} "cast from pointer to unsigned int"
+  name = (uint32_t)osThreadGetName(thread_id);
+  id   = ((uint32_t)CID_EVENT << 8) | MID_EVENT_THREAD_REG;
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+  uint64_t ts64 = EventGetTS64();
+  EventRecord4_Log(id, n + 1U, tid, name, 0U, ts64);
+  ts = (uint32_t)ts64;
+#else
+  ts = EventGetTS();
 #endif
+  ctx = (GetContext() << EVENT_RECORD_CTX_POS) & EVENT_RECORD_CTX_MASK;
+  if (EventRecordItem(id | ctx | EVENT_RECORD_FIRST, ts, n + 1U, tid) != 0U) {
+    (void)EventRecordItem(1U | ctx | EVENT_RECORD_LAST, ts, name, 0U);
+  }
 
-#elif (EVENT_TIMESTAMP_SOURCE == 1)
+  return (n + 1U);
+}
+
+/**
+  Get thread index of running thread (added to Thread Table when used first time)
+  \return       thread index (1..EVENT_THREAD_MAX), 0=IRQ or unknown thread
+*/
+static uint32_t EventThreadIndex (void) {
+  osThreadId_t thread_id;
+  uint32_t tid;
+  uint32_t val;
+  uint32_t n;
+
+  if (__get_IPSR() != 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+  thread_id = osThreadGetId();
+  if (thread_id == NULL) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+  //lint -e{923} "cast from pointer to unsigned int"
+  tid = (uint32_t)thread_id;
+  for (n = 0U; n < EVENT_THREAD_MAX; n++) {
+    val = EventThreadTable[n];
+    if (val == tid) {
+      //lint -e{904} "Return statement before end of function"
+      return (n + 1U);
+    }
+    if (val == 0U) {
+      break;
+    }
+  }
+  return (EventThreadAdd(thread_id));
+}
+
+#else
+
+__STATIC_INLINE uint32_t EventThreadIndex (void) {
+  return 0U;
+}
 
-/* SysTick period in cycles */
-#ifndef SYSTICK_PERIOD
-#define SYSTICK_PERIOD  0x01000000U
 #endif
 
-/* SysTick variables */
-static volatile uint32_t SysTickCount;
-static volatile uint8_t  SysTickUpdated;
 
-/* SysTick IRQ handler */
-void SysTick_Handler (void);
-void SysTick_Handler (void) {
-  SysTickCount  += SYSTICK_PERIOD;
-  SysTickUpdated = 1U;
+#if (EVENT_COALESCE != 0)
+
+/**
+  Record the repeat count of coalesced events
+  \param[in]    id     event identifier of repeated event with IRQ and partition flags
+  \param[in]    thread thread index of repeated event
+  \param[in]    ts     timestamp of last repeat
+  \param[in]    count  number of repeats
+*/
+static void EventRepeatRecord (uint32_t id, uint32_t thread, uint32_t ts, uint32_t count) {
+  if (count != 0U) {
+    (void)EventRecordItemThread(ID_EVENT_REPEAT | (id & (EVENT_RECORD_IRQ | EVENT_RECORD_PART)),
+                                ts, count, id & EVENT_RECORD_ID_MASK, thread);
+  }
 }
 
-/* Setup SysTick */
-__STATIC_INLINE uint32_t SysTickSetup (void) {
-  SysTickCount  = 0U;
-  SysTick->LOAD = SYSTICK_PERIOD - 1U;
-  SysTick->VAL  = 0U;
-  SysTick->CTRL = SysTick_CTRL_ENABLE_Msk     |
-                  SysTick_CTRL_TICKINT_Msk    |
-                  SysTick_CTRL_CLKSOURCE_Msk;
-  return 1U;
+/**
+  Coalesce an event with the last event of the same context (thread or handler mode)
+  \param[in]    id     event identifier with IRQ and partition flags
+  \param[in]    val1   first data value
+  \param[in]    val2   second data value
+  \param[in]    thread thread index
+  \param[in]    ts     timestamp
+  \return       1 when the event repeats the last event (not recorded), 0 otherwise
+*/
+static uint32_t EventCoalesce (uint32_t id, uint32_t val1, uint32_t val2, uint32_t thread, uint32_t ts) {
+  EventRepeat_t *rep;
+  uint32_t primask = __get_PRIMASK();
+  uint32_t masked;
+  uint32_t last_id, last_thread, last_ts;
+  uint32_t count;
+  uint32_t ret;
+
+  rep = &EventRepeat[((id & EVENT_RECORD_IRQ) != 0U) ? 1U : 0U];
+  //lint -e{9044} "function parameter modified"
+  id |= EVENT_RECORD_VALID;
+
+  __disable_irq();
+  masked = EventProfileMaskStart();
+  // Repeated event of the sequence that ends with a different event
+  last_id     = rep->id;
+  last_thread = rep->thread;
+  last_ts     = rep->ts;
+  if ((rep->id == id) && (rep->val1 == val1) && (rep->val2 == val2) && (rep->thread == thread)) {
+    rep->count++;
+    rep->ts     = ts;
+    count       = 0U;
+    ret         = 1U;
+  } else {
+    count       = rep->count;
+    rep->count  = 0U;
+    rep->id     = id;
+    rep->val1   = val1;
+    rep->val2   = val2;
+    rep->thread = thread;
+    ret         = 0U;
+  }
+  EventProfileMaskEnd(masked);
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  EventRepeatRecord(last_id, last_thread, last_ts, count);
+
+  return (ret);
 }
 
-/* Get SysTick frequency */
-__STATIC_INLINE uint32_t SysTickGetFreq (void) {
-  return (SystemCoreClock);
+/**
+  Record the repeat count of the last event of a context and end the sequence of repeats
+  \param[in]    n      context: 0 - thread mode, 1 - handler mode
+*/
+static void EventRepeatFlush (uint32_t n) {
+  EventRepeat_t *rep = &EventRepeat[n];
+  uint32_t primask = __get_PRIMASK();
+  uint32_t masked;
+  uint32_t last_id, last_thread, last_ts;
+  uint32_t count;
+
+  __disable_irq();
+  masked = EventProfileMaskStart();
+  count       = rep->count;
+  last_id     = rep->id;
+  last_thread = rep->thread;
+  last_ts     = rep->ts;
+  rep->count  = 0U;
+  rep->id     = 0U;
+  EventProfileMaskEnd(masked);
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  EventRepeatRecord(last_id, last_thread, last_ts, count);
 }
 
-/* Get SysTick count */
-__STATIC_INLINE uint32_t SysTickGetCount (void) {
-  uint32_t val;
+#endif
 
-  do {
-    SysTickUpdated = 0U;
-    val  = SysTickCount;
-    val += (SYSTICK_PERIOD - 1U) - SysTick->VAL;
-  } while (SysTickUpdated != 0U);
+/**
+  End a sequence of repeated events of the current context
+*/
+__STATIC_INLINE void EventRepeatBreak (void) {
+#if (EVENT_COALESCE != 0)
+  uint32_t n = (__get_IPSR() != 0U) ? 1U : 0U;
 
-  return (val);
+  if (EventRepeat[n].id != 0U) {
+    EventRepeatFlush(n);
+  }
+#endif
 }
 
-#elif (EVENT_TIMESTAMP_SOURCE == 2)
 
-static uint8_t SysTimerState;
+#if (EVENT_IRQ_TRACING != 0)
 
-/* Check if SysTimer is running  */
-__STATIC_INLINE uint32_t SysTimerIsRunning (void) {
-  if (SysTimerState == 0U) {
-    if (osKernelGetState() >= osKernelRunning) {
-      SysTimerState = 1U;
-    }
+/**
+  Record an event of IRQ Tracing (recorded while Event Recorder is running, not filtered)
+  \param[in]    mid    message number (MID_EVENT_IRQ_xxx)
+  \param[in]    val1   first data value
+  \param[in]    val2   second data value
+*/
+__STATIC_INLINE void EventIrqRecord (uint32_t mid, uint32_t val1, uint32_t val2) {
+  uint32_t id;
+  uint32_t ts;
+
+  if (EventStatus.state == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return;
   }
-  return (SysTimerState);
+
+  id = ((uint32_t)CID_EVENT << 8) | mid;
+
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+  uint64_t ts64 = EventGetTS64();
+  EventRecord2_Log(id, val1, val2, ts64);
+  ts = (uint32_t)ts64;
+#else
+  ts = EventGetTS();
+#endif
+
+  id |= (__get_IPSR() != 0U) ? EVENT_RECORD_IRQ : 0U;
+
+  EventRepeatBreak();
+  (void)EventRecordItem(id | EVENT_RECORD_FIRST | EVENT_RECORD_LAST, ts, val1, val2);
+}
+
+/**
+  Trampoline of traced vectors: records entry and exit of the original exception handler
+*/
+static void EventIrqTrampoline (void) {
+  uint32_t n;
+
+  n = __get_IPSR() & 0x1FFU;
+  EventIrqRecord(MID_EVENT_IRQ_ENTRY, n, 0U);
+  EventIrqHandlers[n]();
+  EventIrqRecord(MID_EVENT_IRQ_EXIT,  n, 0U);
 }
 
 #endif
 
 
+#if (EVENT_STATISTICS != 0)
+
 /**
-  Setup timer hardware
-  \return       status (1=Success, 0=Failure)
+  Clear Execution Statistics
 */
-#if (EVENT_TIMESTAMP_SOURCE < 3)
-__WEAK uint32_t EventRecorderTimerSetup (void) {
-#if   (EVENT_TIMESTAMP_SOURCE == 0)
-  #if ((__CORTEX_M >= 3U) && (__CORTEX_M != 23U))
-    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
-    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
-    return 1U;
-  #else
-    TimeStamp = 0U;
-    return 1U;
-  #endif
-#elif (EVENT_TIMESTAMP_SOURCE == 1)
-  return (SysTickSetup());
-#elif (EVENT_TIMESTAMP_SOURCE == 2)
-  SysTimerState = 0U;
-  return 1U;
+static void EventStatisticsClear (void) {
+  uint32_t n;
+
+  for (n = 0U; n < 64U; n++) {
+    EventStatistics[n].count    = 0U;
+    EventStatistics[n].total_lo = 0U;
+    EventStatistics[n].total_hi = 0U;
+    EventStatistics[n].min      = 0xFFFFFFFFU;
+    EventStatistics[n].max      = 0U;
+#if (EVENT_STATISTICS_ENERGY != 0)
+    EventEnergy[n].total_lo     = 0U;
+    EventEnergy[n].total_hi     = 0U;
+#endif
+  }
+#if (EVENT_STATISTICS_HIST != 0)
+  memset(EventHistogram, 0, sizeof(EventHistogram));
+#endif
+}
+
+#if (EVENT_STATISTICS_HIST != 0)
+/**
+  Get Duration Histogram bucket of a time
+  \param[in]    time   time in timer ticks
+  \return       bucket (0..EVENT_HIST_BUCKETS-1)
+*/
+__STATIC_INLINE uint32_t EventHistogramBucket (uint32_t time) {
+  uint32_t bucket;
+
+  time >>= EVENT_STATISTICS_HIST_BASE;
+  if (time == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+  bucket = 32U - (uint32_t)__CLZ(time);
+  if (bucket > (EVENT_HIST_BUCKETS - 1U)) {
+    bucket = EVENT_HIST_BUCKETS - 1U;
+  }
+  return bucket;
+}
+
+/**
+  Record Duration Histogram of a slot
+  \param[in]    n      slot index [16*group + slot]
+  \param[in]    ts     timestamp (64-bit when logged to semihosting)
+*/
+static void EventHistogramRecord (uint32_t n, uint64_t ts) {
+  //lint --e{934} "Taking address of near auto variable"
+  uint8_t  hist[EVENT_HIST_LENGTH];
+  uint32_t val[2];
+  uint32_t count;
+  uint32_t id;
+  uint32_t k;
+
+  // Header: first bucket limit (log2), number of buckets; followed by 16-bit counts (saturated)
+  hist[0] = (uint8_t)EVENT_STATISTICS_HIST_BASE;
+  hist[1] = (uint8_t)EVENT_HIST_BUCKETS;
+  hist[2] = 0U;
+  hist[3] = 0U;
+  for (k = 0U; k < EVENT_HIST_BUCKETS; k++) {
+    count = EventHistogram[n][k];
+    if (count > 0xFFFFU) {
+      count = 0xFFFFU;
+    }
+    hist[4U + (2U * k)] = (uint8_t)count;
+    hist[5U + (2U * k)] = (uint8_t)(count >> 8);
+  }
+
+  id = ((uint32_t)CID_EVENT << 8) | (MID_EVENT_HIST + n);
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+  EventRecordData_Log(id, hist, EVENT_HIST_LENGTH, ts);
+#endif
+  memcpy(val, hist, 8U);
+  (void)EventRecordChain(id, (uint32_t)ts, val[0], val[1], &hist[8], EVENT_HIST_LENGTH - 8U, EVENT_THREAD_NONE);
+}
+#endif
+
+/**
+  Record snapshot of Execution Statistics (one event for each used slot)
+*/
+static void EventStatisticsRecord (void) {
+  EventStatistics_t *stat;
+  uint64_t total;
+  uint32_t count;
+  uint32_t avg;
+  uint32_t ctx;
+  uint32_t id;
+  uint32_t ts;
+  uint32_t n;
+
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+  uint64_t ts64 = EventGetTS64();
+  ts = (uint32_t)ts64;
+#else
+  ts = EventGetTS();
+#endif
+
+  EventRepeatBreak();
+
+  for (n = 0U; n < 64U; n++) {
+    stat  = &EventStatistics[n];
+    count = stat->count;
+    if (count != 0U) {
+      total = ((uint64_t)stat->total_hi << 32) | stat->total_lo;
+      avg   = (uint32_t)(total / count);
+      id    = ((uint32_t)CID_EVENT << 8) | (MID_EVENT_STAT + n);
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+      EventRecord4_Log(id, count, avg, stat->min, stat->max, ts64);
+#endif
+      ctx = (GetContext() << EVENT_RECORD_CTX_POS) & EVENT_RECORD_CTX_MASK;
+      if (EventRecordItem(id | ctx | EVENT_RECORD_FIRST, ts, count, avg) != 0U) {
+        (void)EventRecordItem(1U | ctx | EVENT_RECORD_LAST, ts, stat->min, stat->max);
+      }
+#if (EVENT_STATISTICS_ENERGY != 0)
+      id = ((uint32_t)CID_EVENT << 8) | (MID_EVENT_ENERGY + n);
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+      EventRecord2_Log(id, EventEnergy[n].total_lo, EventEnergy[n].total_hi, ts64);
+#endif
+      (void)EventRecordItem(id | EVENT_RECORD_FIRST | EVENT_RECORD_LAST, ts,
+                            EventEnergy[n].total_lo, EventEnergy[n].total_hi);
+#endif
+#if (EVENT_STATISTICS_HIST != 0)
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+      EventHistogramRecord(n, ts64);
+#else
+      EventHistogramRecord(n, ts);
+#endif
+#endif
+    }
+  }
+}
+
+#if (EVENT_STATISTICS_RECORD == 2)
+/**
+  Record the duration of a Start/Stop pair (instead of the Start and Stop events)
+  \param[in]    n      slot index [16*group + slot]
+  \param[in]    time   duration in timer ticks
+  \param[in]    ts     timestamp of Stop event (64-bit when logged to semihosting)
+*/
+static void EventStatisticsDuration (uint32_t n, uint32_t time, uint64_t ts) {
+  uint32_t thread;
+  uint32_t id;
+
+  thread = EventThreadIndex();
+  id     = ((uint32_t)CID_EVENT << 8) | MID_EVENT_STAT_DURATION;
+
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+  EventRecord2_Log(id | (thread << EVENT_LOG_THREAD_POS), n, time, ts);
+#endif
+
+  EventRepeatBreak();
+
+  id |= (__get_IPSR() != 0U) ? EVENT_RECORD_IRQ : 0U;
+
+  (void)EventRecordItemThread(id | EVENT_RECORD_FIRST | EVENT_RECORD_LAST, (uint32_t)ts, n, time, thread);
+}
+#endif
+
+/**
+  Update Execution Statistics with Start/Stop event
+  \param[in]    id     event identifier of Start/Stop event
+  \param[in]    ts     timestamp (64-bit when logged to semihosting)
+*/
+static void EventStatisticsUpdate (uint32_t id, uint64_t ts) {
+  EventStatistics_t *stat;
+  uint32_t group;
+  uint32_t slot;
+  uint32_t mask;
+  uint32_t run;
+  uint32_t val;
+  uint32_t time;
+#if (EVENT_STATISTICS_ENERGY != 0)
+  uint64_t energy;
+  uint32_t power;
+#endif
+#if ((EVENT_STATISTICS_PERIOD != 0U) || (EVENT_CONTROL != 0))
+  uint64_t period;
+#endif
+
+  // Message number: [7..6]=group, [5]=stop, [4]=values, [3..0]=slot
+  group = (id >> 6) & 0x3U;
+  slot  =  id       & 0xFU;
+
+  if ((id & 0x20U) == 0U) {
+#if (EVENT_STATISTICS_ENERGY != 0)
+    EventEnergy[(group << 4) | slot].power = EventRecorderPowerGetSample();
+#endif
+    EventStatistics[(group << 4) | slot].start = (uint32_t)ts;
+    atomic_or_32(&EventStatisticsRunning[group], 1UL << slot);
+    //lint -e{904} "Return statement before end of function"
+    return;
+  }
+
+  // Stop of slot 15 stops all slots of the group
+  mask = (slot == 15U) ? 0xFFFFU : (1UL << slot);
+  run  = EventStatisticsRunning[group];
+  while (atomic_cmp_xch_32(&EventStatisticsRunning[group], &run, run & ~mask) == 0U) {
+    ;
+  }
+  run &= mask;
+#if (EVENT_STATISTICS_ENERGY != 0)
+  power = (run != 0U) ? EventRecorderPowerGetSample() : 0U;
+#endif
+
+  for (slot = 0U; run != 0U; slot++) {
+    if ((run & 1U) != 0U) {
+      stat = &EventStatistics[(group << 4) | slot];
+      time = (uint32_t)ts - stat->start;
+      (void)atomic_inc_32(&stat->count);
+      if (atomic_add_32(&stat->total_lo, time) > (0xFFFFFFFFU - time)) {
+        (void)atomic_inc_32(&stat->total_hi);
+      }
+      val = stat->min;
+      while ((time < val) && (atomic_cmp_xch_32(&stat->min, &val, time) == 0U)) {
+        ;
+      }
+      val = stat->max;
+      while ((time > val) && (atomic_cmp_xch_32(&stat->max, &val, time) == 0U)) {
+        ;
+      }
+#if (EVENT_STATISTICS_HIST != 0)
+      (void)atomic_inc_32(&EventHistogram[(group << 4) | slot][EventHistogramBucket(time)]);
+#endif
+#if (EVENT_STATISTICS_ENERGY != 0)
+      // Energy: average of power samples at Start and Stop multiplied with time
+      energy = (uint64_t)((EventEnergy[(group << 4) | slot].power >> 1) + (power >> 1)) * time;
+      val    = (uint32_t)energy;
+      if (atomic_add_32(&EventEnergy[(group << 4) | slot].total_lo, val) > (0xFFFFFFFFU - val)) {
+        (void)atomic_inc_32(&EventEnergy[(group << 4) | slot].total_hi);
+      }
+      (void)atomic_add_32(&EventEnergy[(group << 4) | slot].total_hi, (uint32_t)(energy >> 32));
+#endif
+#if (EVENT_STATISTICS_RECORD == 2)
+      EventStatisticsDuration((group << 4) | slot, time, ts);
+#endif
+    }
+    run >>= 1;
+  }
+
+#if ((EVENT_STATISTICS_PERIOD != 0U) || (EVENT_CONTROL != 0))
+  period = ((uint64_t)EventStatus.ts_freq * EventStatisticsPeriod) / 1000U;
+  if (period > 0x80000000U) {
+    period = 0x80000000U;
+  }
+  val = EventStatisticsSnapshotTS;
+  if ((period != 0U) && (((uint32_t)ts - val) >= (uint32_t)period)) {
+    if (atomic_cmp_xch_32(&EventStatisticsSnapshotTS, &val, (uint32_t)ts) != 0U) {
+      EventStatisticsRecord();
+    }
+  }
+#endif
+}
+
+#endif
+
+
+/**
+  Calculate CRC16-CCITT (16-bit, polynom=0x1021, init_value=0xFFFF)
+  \param[in]    data  pointer to data
+  \param[in]    len   data length (in bytes)
+  \return             CRC16-CCITT value
+*/
+static uint16_t crc16_ccitt (const uint8_t *data, uint32_t len) {
+  uint16_t crc;
+  uint32_t n;
+
+  crc = 0xFFFFU;
+  while (len != 0U) {
+    //lint -e{9049} "increment/decrement operation combined with other operation"
+    crc ^= ((uint16_t)*data++ << 8);
+    for (n = 8U; n != 0U; n--) {
+      if ((crc & 0x8000U) != 0U) {
+        crc <<= 1;
+        crc  ^= 0x1021U;
+      } else {
+        crc <<= 1;
+      }
+    }
+    len--;
+  }
+
+  return (crc);
+}
+
+
+#if   (EVENT_TIMESTAMP_SOURCE == 0)
+#if ((__CORTEX_M < 3U) || (__CORTEX_M == 23U))
+#ifndef _lint
+#warning "Invalid Time Stamp Source selected in EventRecorderConf.h!"
+#endif
+static uint32_t TimeStamp __NO_INIT;
+#endif
+
+#elif (EVENT_TIMESTAMP_SOURCE == 1)
+
+/* SysTick period in cycles */
+#ifndef SYSTICK_PERIOD
+#define SYSTICK_PERIOD  0x01000000U
+#endif
+
+/* SysTick variables */
+static volatile uint32_t SysTickCount;
+static volatile uint8_t  SysTickUpdated;
+
+/* SysTick IRQ handler */
+void SysTick_Handler (void);
+void SysTick_Handler (void) {
+  SysTickCount  += SYSTICK_PERIOD;
+  SysTickUpdated = 1U;
+}
+
+/* Setup SysTick */
+__STATIC_INLINE uint32_t SysTickSetup (void) {
+  SysTickCount  = 0U;
+  SysTick->LOAD = SYSTICK_PERIOD - 1U;
+  SysTick->VAL  = 0U;
+  SysTick->CTRL = SysTick_CTRL_ENABLE_Msk     |
+                  SysTick_CTRL_TICKINT_Msk    |
+                  SysTick_CTRL_CLKSOURCE_Msk;
+  return 1U;
+}
+
+/* Get SysTick frequency */
+__STATIC_INLINE uint32_t SysTickGetFreq (void) {
+  return (SystemCoreClock);
+}
+
+/* Get SysTick count */
+__STATIC_INLINE uint32_t SysTickGetCount (void) {
+  uint32_t val;
+
+  do {
+    SysTickUpdated = 0U;
+    val  = SysTickCount;
+    val += (SYSTICK_PERIOD - 1U) - SysTick->VAL;
+  } while (SysTickUpdated != 0U);
+
+  return (val);
+}
+
+#elif (EVENT_TIMESTAMP_SOURCE == 2)
+
+static uint8_t SysTimerState;
+
+/* Check if SysTimer is running  */
+__STATIC_INLINE uint32_t SysTimerIsRunning (void) {
+  if (SysTimerState == 0U) {
+    if (osKernelGetState() >= osKernelRunning) {
+      SysTimerState = 1U;
+    }
+  }
+  return (SysTimerState);
+}
+
+#endif
+
+
+/**
+  Setup timer hardware
+  \return       status (1=Success, 0=Failure)
+*/
+#if (EVENT_TIMESTAMP_SOURCE < 3)
+__WEAK uint32_t EventRecorderTimerSetup (void) {
+#if   (EVENT_TIMESTAMP_SOURCE == 0)
+  #if ((__CORTEX_M >= 3U) && (__CORTEX_M != 23U))
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    return 1U;
+  #else
+    TimeStamp = 0U;
+    return 1U;
+  #endif
+#elif (EVENT_TIMESTAMP_SOURCE == 1)
+  return (SysTickSetup());
+#elif (EVENT_TIMESTAMP_SOURCE == 2)
+  SysTimerState = 0U;
+  return 1U;
+#endif
+}
+#endif
+
+/**
+  Get timer frequency
+  \return       timer frequency in Hz
+*/
+#if (EVENT_TIMESTAMP_SOURCE < 3)
+__WEAK uint32_t EventRecorderTimerGetFreq (void) {
+#if   (EVENT_TIMESTAMP_SOURCE == 0)
+  #if ((__CORTEX_M >= 3U) && (__CORTEX_M != 23U))
+    return (SystemCoreClock);
+  #else
+    return 0U;
+  #endif
+#elif (EVENT_TIMESTAMP_SOURCE == 1)
+  return (SysTickGetFreq());
+#elif (EVENT_TIMESTAMP_SOURCE == 2)
+  uint32_t freq;
+
+  if (SysTimerIsRunning() != 0U) {
+    freq = osKernelGetSysTimerFreq();
+  } else {
+    freq = 0U;
+  }
+  return (freq);
+#endif
+}
+#endif
+
+/**
+  Get timer count
+  \return       timer count (32-bit)
+*/
+#if (EVENT_TIMESTAMP_SOURCE < 3)
+__WEAK uint32_t EventRecorderTimerGetCount (void) {
+#if   (EVENT_TIMESTAMP_SOURCE == 0)
+  #if ((__CORTEX_M >= 3U) && (__CORTEX_M != 23U))
+    return (DWT->CYCCNT);
+  #else
+    return (TimeStamp++);
+  #endif
+#elif (EVENT_TIMESTAMP_SOURCE == 1)
+  return (SysTickGetCount());
+#elif (EVENT_TIMESTAMP_SOURCE == 2)
+  uint32_t count;
+
+  if (SysTimerIsRunning() != 0U) {
+    count = osKernelGetSysTimerCount();
+  } else {
+    count = 0U;
+  }
+  return (count);
+#endif
+}
+#endif
+
+/**
+  Notification of a fill-level watermark crossing
+  \param[in]    event  EventWatermarkHigh or EventWatermarkLow
+*/
+#if (EVENT_WATERMARK != 0)
+__WEAK void EventRecorderWatermark (uint32_t event) {
+  (void)event;
+}
+#endif
+
+/**
+  Get power sample for energy of execution statistics
+  \return       power in uW
+*/
+#if ((EVENT_STATISTICS != 0) && (EVENT_STATISTICS_ENERGY != 0))
+__WEAK uint32_t EventRecorderPowerGetSample (void) {
+  return 0U;
+}
+#endif
+
+
+#if ((EVENT_LAZY_INIT == 0) || (EVENT_PARTITION != 0))
+/**
+  Invalidate records that are locked (write interrupted by reset)
+  \param[in]    buffer pointer to records
+  \param[in]    count  number of records
+*/
+static void ClearLockedRecords (EventRecord_t *buffer, uint32_t count) {
+  EventRecord_t *record;
+  uint32_t n;
+
+  for (n = 0U; n < count; n++) {
+    record = &buffer[n];
+    if ((record->info & EVENT_RECORD_LOCKED) != 0U) {
+      record->info &= ~(EVENT_RECORD_LOCKED | EVENT_RECORD_VALID);
+    }
+  }
+}
+#endif
+
+/**
+  Initialize Event Recorder
+  \param[in]    recording   initial level mask for event record filter
+  \param[in]    start       initial recording setup (1=start, 0=stop)
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventRecorderInitialize (uint32_t recording, uint32_t start) {
+  uint16_t crc;
+  uint32_t freq;
+  uint32_t ret;
+  uint32_t ts;
+#if (EVENT_STATISTICS != 0)
+  uint32_t n;
+#endif
+
+  EventStatus.state = 0U;
+  memset(&EventFilter[0], 0, sizeof(EventFilter));
+#if (EVENT_PREDICATES != 0)
+  EventPredicateUsed = 0U;
+  memset(&EventPredicate[0], 0, sizeof(EventPredicate));
+#endif
+#if (EVENT_CONTROL != 0)
+  // Commands written to the mailbox before initialization are discarded
+  EventTrigger.state = EVENT_TRIGGER_OFF;
+  EventControl.ack   = EventControl.request;
+#endif
+
+  crc = crc16_ccitt((const uint8_t *)&EventRecorderInfo, sizeof(EventRecorderInfo));
+
+  if (EventStatus.signature != SIGNATURE) {
+    EventStatus.signature  = SIGNATURE;
+    EventStatus.info_crc   = crc;
+    EventStatus.init_count = 1U;
+  } else {
+    if (EventStatus.info_crc != crc) {
+      EventStatus.info_crc   = crc;
+      EventStatus.init_count = 1U;
+    } else {
+      EventStatus.init_count++;
+    }
+  }
+
+  if (EventStatus.init_count == 1U) {
+    StatisticsHandle            = 0U;
+    EventStatus.context         = 0U;
+    EventStatus.record_index    = 0U;
+    EventStatus.records_written = 0U;
+    EventStatus.records_dumped  = 0U;
+    EventStatus.records_read    = 0U;
+    EventStatus.events_rejected = 0U;
+#if (EVENT_LAZY_INIT == 0)
+    memset(&EventBuffer[0], 0, sizeof(EventBuffer));
+#endif
+#if (EVENT_PARTITION != 0)
+    EventReservedIndex = 0U;
+    memset(&EventBufferReserved[0], 0, sizeof(EventBufferReserved));
+#endif
+#if (EVENT_PROFILING != 0)
+    memset(&EventProfile, 0, sizeof(EventProfile));
+#endif
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+    FileHandle = sys_open(EVENT_LOG_FILENAME, MODE_wb);
+#endif
+  } else {
+#if (EVENT_LAZY_INIT == 0)
+    ClearLockedRecords(&EventBuffer[0], EVENT_RECORD_COUNT);
+#endif
+#if (EVENT_PARTITION != 0)
+    ClearLockedRecords(&EventBufferReserved[0], EVENT_PARTITION_COUNT);
+#endif
+  }
+  EventStatus.record_start     = EventStatus.record_index;
+#if (EVENT_COMMIT_INDEX != 0)
+  EventStatus.record_committed = EventStatus.record_index;
+  EventWriters = 0U;
+#endif
+
+  if (EventStatus.init_count == 1U) {
+    ret = EventRecorderTimerSetup();
+    if (ret != 0U) {
+      #if (defined(EVENT_TIMESTAMP_FREQ) && (EVENT_TIMESTAMP_FREQ != 0U))
+        freq = EVENT_TIMESTAMP_FREQ;
+      #else
+        freq = EventRecorderTimerGetFreq();
+      #endif
+    } else {
+      freq = 0U;
+    }
+    EventStatus.ts_freq     = freq;
+    EventStatus.ts_last     = 0U;
+    EventStatus.ts_overflow = 0U;
+  } else {
+#if    (EVENT_TIMESTAMP_SOURCE == 0)
+  #if ((__CORTEX_M >= 3U) && (__CORTEX_M != 23U))
+    ret = EventRecorderTimerSetup();
+  #else
+    ret = 1U;
+  #endif
+#elif ((EVENT_TIMESTAMP_SOURCE >= 1) && (EVENT_TIMESTAMP_SOURCE <= 3))
+    ret = EventRecorderTimerSetup();
+    if (ret != 0U) {
+      #if (defined(EVENT_TIMESTAMP_FREQ) && (EVENT_TIMESTAMP_FREQ != 0U))
+        freq = EVENT_TIMESTAMP_FREQ;
+      #else
+        freq = EventRecorderTimerGetFreq();
+      #endif
+    } else {
+      freq = 0U;
+    }
+    EventStatus.ts_freq     = freq;
+    EventStatus.ts_last     = 0U;
+    EventStatus.ts_overflow = 0U;
+#else
+    ret = 1U;
+#endif
+  }
+
+  if (ret != 0U) {
+
+    (void)EventRecorderEnable(recording,      0x00U,            0xFEU);
+    (void)EventRecorderEnable(EventRecordAll, EvtStatistics_No, EvtStatistics_No);
+    (void)EventRecorderEnable(EventRecordOp,  EvtPrintf_No,     EvtPrintf_No);
+
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+    uint64_t ts64 = EventGetTS64();
+    EventRecord2_Log(ID_EVENT_INIT & EVENT_RECORD_ID_MASK, EventStatus.init_count, EventStatus.ts_freq, ts64);
+    ts = (uint32_t)ts64;
+#else
+    ts = EventGetTS();
+#endif
+
+    (void)EventRecordItem(ID_EVENT_INIT, ts, EventStatus.init_count, EventStatus.ts_freq);
+
+#if (EVENT_THREAD_TAGGING != 0)
+    // Threads are added again (and their thread index recorded) when used first time
+    memset(EventThreadTable, 0, sizeof(EventThreadTable));
+    EventThreadLast = 0U;
+#if (EVENT_ITM != 0)
+    EventThreadLastITM = 0U;
+#endif
+#endif
+
+#if (EVENT_STATISTICS != 0)
+    if (EventStatus.init_count == 1U) {
+      EventStatisticsClear();
+    }
+    for (n = 0U; n < 4U; n++) {
+      EventStatisticsRunning[n] = 0U;
+    }
+    EventStatisticsSnapshotTS = ts;
+#endif
+
+    if (start != 0U) {
+      (void)EventRecorderStart();
+    }
+  }
+
+  return (ret);
+}
+
+/**
+  Enable recording of events with specified level and component range
+  \param[in]    recording   level mask for event record filter
+  \param[in]    comp_start  first component number of range
+  \param[in]    comp_end    last Component number of range
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventRecorderEnable (uint32_t recording, uint32_t comp_start, uint32_t comp_end) {
+  uint32_t ofs;
+  uint32_t i, n;
+
+  if ((comp_start >= 0xFFU) || (comp_end >= 0xFFU)) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+
+  ofs = 0U;
+  for (i = 0U; i < 4U; i++) {
+    if ((recording & (1UL << i)) != 0U) {
+      for (n = comp_start >> 5; n <= (comp_end >> 5); n++) {
+        atomic_or_32(&EventFilter[ofs + n], EventFilterMask(n, comp_start, comp_end));
+      }
+    }
+    ofs += 8U;
+  }
+
+  return 1U;
+}
+
+/**
+  Disable recording of events with specified level and component range
+  \param[in]    recording   level mask for event record filter
+  \param[in]    comp_start  first component number of range
+  \param[in]    comp_end    last Component number of range
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventRecorderDisable (uint32_t recording, uint32_t comp_start, uint32_t comp_end) {
+  uint32_t ofs;
+  uint32_t i, n;
+
+  if ((comp_start >= 0xFFU) || (comp_end >= 0xFFU)) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+
+  ofs = 0U;
+  for (i = 0U; i < 4U; i++) {
+    if ((recording & (1UL << i)) != 0U) {
+      for (n = comp_start >> 5; n <= (comp_end >> 5); n++) {
+        atomic_and_32(&EventFilter[ofs + n], ~EventFilterMask(n, comp_start, comp_end));
+      }
+    }
+    ofs += 8U;
+  }
+
+  return 1U;
+}
+
+/**
+  Enable events with specified level and component range in a filter profile
+  \param[out]   filter      pointer to filter profile
+  \param[in]    recording   level mask for event record filter
+  \param[in]    comp_start  first component number of range
+  \param[in]    comp_end    last Component number of range
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventRecorderFilterEnable (EventRecorderFilter_t *filter,
+                                    uint32_t recording, uint32_t comp_start, uint32_t comp_end) {
+  uint32_t ofs;
+  uint32_t i, n;
+
+  if ((filter == NULL) || (comp_start >= 0xFFU) || (comp_end >= 0xFFU)) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+
+  ofs = 0U;
+  for (i = 0U; i < 4U; i++) {
+    if ((recording & (1UL << i)) != 0U) {
+      for (n = comp_start >> 5; n <= (comp_end >> 5); n++) {
+        filter->mask[ofs + n] |= EventFilterMask(n, comp_start, comp_end);
+      }
+    }
+    ofs += 8U;
+  }
+
+  return 1U;
+}
+
+/**
+  Disable events with specified level and component range in a filter profile
+  \param[out]   filter      pointer to filter profile
+  \param[in]    recording   level mask for event record filter
+  \param[in]    comp_start  first component number of range
+  \param[in]    comp_end    last Component number of range
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventRecorderFilterDisable (EventRecorderFilter_t *filter,
+                                     uint32_t recording, uint32_t comp_start, uint32_t comp_end) {
+  uint32_t ofs;
+  uint32_t i, n;
+
+  if ((filter == NULL) || (comp_start >= 0xFFU) || (comp_end >= 0xFFU)) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+
+  ofs = 0U;
+  for (i = 0U; i < 4U; i++) {
+    if ((recording & (1UL << i)) != 0U) {
+      for (n = comp_start >> 5; n <= (comp_end >> 5); n++) {
+        filter->mask[ofs + n] &= ~EventFilterMask(n, comp_start, comp_end);
+      }
+    }
+    ofs += 8U;
+  }
+
+  return 1U;
+}
+
+/**
+  Get current event filter settings
+  \param[out]   filter      pointer to filter profile
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventRecorderFilterGet (EventRecorderFilter_t *filter) {
+  uint32_t n;
+
+  if (filter == NULL) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+
+  for (n = 0U; n < 32U; n++) {
+    filter->mask[n] = *((volatile uint32_t *)&EventFilter[n]);
+  }
+
+  return 1U;
+}
+
+/**
+  Apply filter profile to event filter
+  \param[in]    filter      pointer to filter profile
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventRecorderFilterSet (const EventRecorderFilter_t *filter) {
+  uint32_t primask;
+  uint32_t n;
+
+  if (filter == NULL) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  for (n = 0U; n < 32U; n++) {
+    *((volatile uint32_t *)&EventFilter[n]) = filter->mask[n];
+  }
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  return 1U;
+}
+
+/**
+  Set value predicate for events that pass the event filter
+  \param[in]    n           predicate number (0 .. EVENT_PREDICATES-1)
+  \param[in]    id          event identifier (level, component number, message number)
+  \param[in]    id_mask     mask of compared identifier bits
+  \param[in]    index       index of 32-bit value (0=val1, 1=val2, ...)
+  \param[in]    op          comparison (EventPredicateXX, \ref EventPredicateNone clears the predicate)
+  \param[in]    value       constant compared with the value
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventRecorderPredicateSet (uint32_t n, uint32_t id, uint32_t id_mask,
+                                    uint32_t index, uint32_t op, uint32_t value) {
+#if (EVENT_PREDICATES != 0)
+  EventPredicate_t *pred;
+
+  if ((n >= EVENT_PREDICATES) || (index > 63U) || (op > EventPredicateAllClr)) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+
+  // Predicate is not used while it is changed
+  atomic_and_32(&EventPredicateUsed, ~(1UL << n));
+  __COMPILER_BARRIER();
+
+  pred = &EventPredicate[n];
+  pred->id      = id      & (EVENT_RECORD_ID_MASK | 0x30000U);
+  pred->id_mask = id_mask & (EVENT_RECORD_ID_MASK | 0x30000U);
+  pred->value   = value;
+  pred->index   = (uint8_t)index;
+  pred->op      = (uint8_t)op;
+
+  if (op != EventPredicateNone) {
+    __DMB();
+    atomic_or_32(&EventPredicateUsed, 1UL << n);
+  }
+
+  return 1U;
+#else
+  (void)n;
+  (void)id;
+  (void)id_mask;
+  (void)index;
+  (void)op;
+  (void)value;
+  return 0U;
+#endif
+}
+
+/**
+  Execute control commands received by a user transport
+  \param[in]    data        pointer to commands (EventControlLength bytes each)
+  \param[in]    len         length of commands in bytes
+  \return       number of executed commands
+*/
+uint32_t EventRecorderControl (const void *data, uint32_t len) {
+#if (EVENT_CONTROL != 0)
+  const uint8_t *cmd;
+  uint32_t n;
+
+  if (data == NULL) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+
+  // Commands are executed until the first failing command
+  cmd = (const uint8_t *)data;
+  for (n = 0U; len >= EventControlLength; n++) {
+    if (EventControlExecute(cmd) == 0U) {
+      break;
+    }
+    cmd += EventControlLength;
+    len -= EventControlLength;
+  }
+
+  return (n);
+#else
+  (void)data;
+  (void)len;
+  return 0U;
 #endif
 }
-#endif
 
 /**
-  Get timer frequency
-  \return       timer frequency in Hz
+  Execute pending command of the control mailbox
+  \return       number of executed commands (0 or 1)
 */
-#if (EVENT_TIMESTAMP_SOURCE < 3)
-__WEAK uint32_t EventRecorderTimerGetFreq (void) {
-#if   (EVENT_TIMESTAMP_SOURCE == 0)
-  #if ((__CORTEX_M >= 3U) && (__CORTEX_M != 23U))
-    return (SystemCoreClock);
-  #else
-    return 0U;
-  #endif
-#elif (EVENT_TIMESTAMP_SOURCE == 1)
-  return (SysTickGetFreq());
-#elif (EVENT_TIMESTAMP_SOURCE == 2)
-  uint32_t freq;
+uint32_t EventRecorderControlPoll (void) {
+#if (EVENT_CONTROL != 0)
+  uint8_t  cmd[EventControlLength];
+  uint32_t request;
 
-  if (SysTimerIsRunning() != 0U) {
-    freq = osKernelGetSysTimerFreq();
-  } else {
-    freq = 0U;
+  request = *((volatile uint32_t *)&EventControl.request);
+  if (request == EventControl.ack) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
   }
-  return (freq);
+
+  // Command is read after the request counter written by the host
+  __DMB();
+  memcpy(cmd, (const uint8_t *)EventControl.cmd, sizeof(cmd));
+  EventControl.status = EventControlExecute(cmd);
+  __DMB();
+  EventControl.ack = request;
+
+  return 1U;
+#else
+  return 0U;
 #endif
 }
-#endif
 
 /**
-  Get timer count
-  \return       timer count (32-bit)
+  Start event recording
+  \return       status (1=Success, 0=Failure)
 */
-#if (EVENT_TIMESTAMP_SOURCE < 3)
-__WEAK uint32_t EventRecorderTimerGetCount (void) {
-#if   (EVENT_TIMESTAMP_SOURCE == 0)
-  #if ((__CORTEX_M >= 3U) && (__CORTEX_M != 23U))
-    return (DWT->CYCCNT);
-  #else
-    return (TimeStamp++);
-  #endif
-#elif (EVENT_TIMESTAMP_SOURCE == 1)
-  return (SysTickGetCount());
-#elif (EVENT_TIMESTAMP_SOURCE == 2)
-  uint32_t count;
+uint32_t EventRecorderStart (void) {
+  uint32_t ts;
 
-  if (SysTimerIsRunning() != 0U) {
-    count = osKernelGetSysTimerCount();
-  } else {
-    count = 0U;
+  if (EventStatus.state != 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return 1U;
   }
-  return (count);
-#endif
-}
+  EventStatus.state = 1U;
+
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+  uint64_t ts64 = EventGetTS64();
+  EventRecord2_Log(ID_EVENT_START & EVENT_RECORD_ID_MASK, 0U, 0U, ts64);
+  ts = (uint32_t)ts64;
+#else
+  ts = EventGetTS();
 #endif
 
+  EventRepeatBreak();
+  (void)EventRecordItem(ID_EVENT_START, ts, 0U, 0U);
+
+  return 1U;
+}
 
 /**
-  Initialize Event Recorder
-  \param[in]    recording   initial level mask for event record filter
-  \param[in]    start       initial recording setup (1=start, 0=stop)
+  Stop event recording
   \return       status (1=Success, 0=Failure)
 */
-uint32_t EventRecorderInitialize (uint32_t recording, uint32_t start) {
-  EventRecord_t *record;
-  uint16_t crc;
-  uint32_t freq;
-  uint32_t ret;
+uint32_t EventRecorderStop (void) {
   uint32_t ts;
-  uint32_t n;
-
-  EventStatus.state = 0U;
-  memset(&EventFilter[0], 0, sizeof(EventFilter));
-
-  crc = crc16_ccitt((const uint8_t *)&EventRecorderInfo, sizeof(EventRecorderInfo));
 
-  if (EventStatus.signature != SIGNATURE) {
-    EventStatus.signature  = SIGNATURE;
-    EventStatus.info_crc   = crc;
-    EventStatus.init_count = 1U;
-  } else {
-    if (EventStatus.info_crc != crc) {
-      EventStatus.info_crc   = crc;
-      EventStatus.init_count = 1U;
-    } else {
-      EventStatus.init_count++;
-    }
+  if (EventStatus.state == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return 1U;
   }
+  EventStatus.state = 0U;
 
-  if (EventStatus.init_count == 1U) {
-    EventStatus.context         = 0U;
-    EventStatus.record_index    = 0U;
-    EventStatus.records_written = 0U;
-    EventStatus.records_dumped  = 0U;
-    memset(&EventBuffer[0], 0, sizeof(EventBuffer));
-#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
-    FileHandle = sys_open(EVENT_LOG_FILENAME, MODE_wb);
+#if (EVENT_COALESCE != 0)
+  EventRepeatFlush(0U);
+  EventRepeatFlush(1U);
 #endif
-  } else {
-    for (n = 0U; n < EVENT_RECORD_COUNT; n++) {
-      record = &EventBuffer[n];
-      if ((record->info & EVENT_RECORD_LOCKED) != 0U) {
-        record->info &= ~(EVENT_RECORD_LOCKED | EVENT_RECORD_VALID);
-      }
-    }
-  }
 
-  if (EventStatus.init_count == 1U) {
-    ret = EventRecorderTimerSetup();
-    if (ret != 0U) {
-      #if (defined(EVENT_TIMESTAMP_FREQ) && (EVENT_TIMESTAMP_FREQ != 0U))
-        freq = EVENT_TIMESTAMP_FREQ;
-      #else
-        freq = EventRecorderTimerGetFreq();
-      #endif
-    } else {
-      freq = 0U;
-    }
-    EventStatus.ts_freq     = freq;
-    EventStatus.ts_last     = 0U;
-    EventStatus.ts_overflow = 0U;
-  } else {
-#if    (EVENT_TIMESTAMP_SOURCE == 0)
-  #if ((__CORTEX_M >= 3U) && (__CORTEX_M != 23U))
-    ret = EventRecorderTimerSetup();
-  #else
-    ret = 1U;
-  #endif
-#elif ((EVENT_TIMESTAMP_SOURCE >= 1) && (EVENT_TIMESTAMP_SOURCE <= 3))
-    ret = EventRecorderTimerSetup();
-    if (ret != 0U) {
-      #if (defined(EVENT_TIMESTAMP_FREQ) && (EVENT_TIMESTAMP_FREQ != 0U))
-        freq = EVENT_TIMESTAMP_FREQ;
-      #else
-        freq = EventRecorderTimerGetFreq();
-      #endif
-    } else {
-      freq = 0U;
-    }
-    EventStatus.ts_freq     = freq;
-    EventStatus.ts_last     = 0U;
-    EventStatus.ts_overflow = 0U;
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+  uint64_t ts64 = EventGetTS64();
+  EventRecord2_Log(ID_EVENT_STOP & EVENT_RECORD_ID_MASK, 0U, 0U, ts64);
+  ts = (uint32_t)ts64;
 #else
-    ret = 1U;
+  ts = EventGetTS();
 #endif
-  }
 
-  if (ret != 0U) {
+  (void)EventRecordItem(ID_EVENT_STOP, ts, 0U, 0U);
 
-    (void)EventRecorderEnable(recording,      0x00U,            0xFEU);
-    (void)EventRecorderEnable(EventRecordAll, EvtStatistics_No, EvtStatistics_No);
-    (void)EventRecorderEnable(EventRecordOp,  EvtPrintf_No,     EvtPrintf_No);
+  return 1U;
+}
+
+/**
+  Update Event Recorder timestamp clock
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventRecorderClockUpdate (void) {
+  uint32_t ts;
+
+  EventStatus.ts_freq = EventRecorderTimerGetFreq();
 
 #ifdef RTE_CMSIS_View_EventRecorder_Semihosting
-    uint64_t ts64 = EventGetTS64();
-    EventRecord2_Log(ID_EVENT_INIT & EVENT_RECORD_ID_MASK, EventStatus.init_count, EventStatus.ts_freq, ts64);
-    ts = (uint32_t)ts64;
+  uint64_t ts64 = EventGetTS64();
+  EventRecord2_Log(ID_EVENT_CLOCK & EVENT_RECORD_ID_MASK, EventStatus.ts_freq, 0U, ts64);
+  ts = (uint32_t)ts64;
 #else
-    ts = EventGetTS();
+  ts = EventGetTS();
 #endif
 
-    (void)EventRecordItem(ID_EVENT_INIT, ts, EventStatus.init_count, EventStatus.ts_freq);
+  EventRepeatBreak();
+  (void)EventRecordItem(ID_EVENT_CLOCK, ts, EventStatus.ts_freq, 0U);
 
-    if (start != 0U) {
-      (void)EventRecorderStart();
-    }
+  return 1U;
+}
+
+/**
+  Record snapshot of Execution Statistics
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventRecorderStatisticsSnapshot (void) {
+#if (EVENT_STATISTICS != 0)
+
+  if (EventStatus.state != 0U) {
+    EventStatisticsRecord();
   }
 
-  return (ret);
+  return 1U;
+#else
+  return 0U;
+#endif
 }
 
 /**
-  Enable recording of events with specified level and component range
-  \param[in]    recording   level mask for event record filter
-  \param[in]    comp_start  first component number of range
-  \param[in]    comp_end    last Component number of range
+  Record snapshot of Recorder Self-Profiling counters
   \return       status (1=Success, 0=Failure)
 */
-uint32_t EventRecorderEnable (uint32_t recording, uint32_t comp_start, uint32_t comp_end) {
-  uint32_t ofs;
-  uint32_t i, j;
+uint32_t EventRecorderProfileSnapshot (void) {
+#if (EVENT_PROFILING != 0)
+  //lint --e{934} "Taking address of near auto variable"
+  uint32_t val[EVENT_PROFILE_LENGTH / 4U];
+  uint32_t id;
+  uint32_t ts;
 
-  if ((comp_start >= 0xFFU) || (comp_end >= 0xFFU)) {
+  if (EventStatus.state == 0U) {
     //lint -e{904} "Return statement before end of function"
     return 0U;
   }
 
-  ofs = 0U;
-  for (i = 0U; i < 4U; i++) {
-    if ((recording & (1UL << i)) != 0U) {
-      for (j = comp_start; j <= comp_end; j++) {
-        EventFilter[ofs + (j >> 3)] |= (1U << (j & 0x7U));
-      }
-    }
-    ofs += 32U;
-  }
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+  uint64_t ts64 = EventGetTS64();
+  ts = (uint32_t)ts64;
+#else
+  ts = EventGetTS();
+#endif
 
-  return 1U;
+  memcpy(val, &EventProfile, EVENT_PROFILE_LENGTH);
+  id = ((uint32_t)CID_EVENT << 8) | MID_EVENT_PROFILE;
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+  EventRecordData_Log(id, (const uint8_t *)val, EVENT_PROFILE_LENGTH, ts64);
+#endif
+
+  EventRepeatBreak();
+  return (EventRecordChain(id, ts, val[0], val[1], (const uint8_t *)&val[2], EVENT_PROFILE_LENGTH - 8U, EVENT_THREAD_NONE));
+#else
+  return 0U;
+#endif
 }
 
 /**
-  Disable recording of events with specified level and component range
-  \param[in]    recording   level mask for event record filter
-  \param[in]    comp_start  first component number of range
-  \param[in]    comp_end    last Component number of range
+  Reset Execution Statistics
   \return       status (1=Success, 0=Failure)
 */
-uint32_t EventRecorderDisable (uint32_t recording, uint32_t comp_start, uint32_t comp_end) {
-  uint32_t ofs;
-  uint32_t i, j;
+uint32_t EventRecorderStatisticsReset (void) {
+#if (EVENT_STATISTICS != 0)
 
-  if ((comp_start >= 0xFFU) || (comp_end >= 0xFFU)) {
+  EventStatisticsClear();
+
+  return 1U;
+#else
+  return 0U;
+#endif
+}
+
+/**
+  Register a thread for thread tagging
+  \param[in]    thread_id   thread identifier
+  \return       thread index (1..63), 0=Failure
+*/
+uint32_t EventRecorderThreadRegister (void *thread_id) {
+#if (EVENT_THREAD_TAGGING != 0)
+
+  if ((thread_id == NULL) || (EventStatus.state == 0U)) {
     //lint -e{904} "Return statement before end of function"
     return 0U;
   }
 
-  ofs = 0U;
-  for (i = 0U; i < 4U; i++) {
-    if ((recording & (1UL << i)) != 0U) {
-      for (j = comp_start; j <= comp_end; j++) {
-        EventFilter[ofs + (j >> 3)] &= ~(1U << (j & 0x7U));
-      }
+  return (EventThreadAdd((osThreadId_t)thread_id));
+#else
+  (void)thread_id;
+  return 0U;
+#endif
+}
+
+/**
+  Acknowledge records read from the event buffer
+  \param[in]    count  number of records read
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventRecorderAcknowledge (uint32_t count) {
+  uint32_t val;
+
+  val = EventStatus.records_read;
+  do {
+    if (count > (EventStatus.record_index - val)) {
+      //lint -e{904} "Return statement before end of function"
+      return 0U;
     }
-    ofs += 32U;
-  }
+  } while (atomic_cmp_xch_32(&EventStatus.records_read, &val, val + count) == 0U);
+
+  EventWatermarkCheck();
 
   return 1U;
 }
 
 /**
-  Start event recording
-  \return       status (1=Success, 0=Failure)
+  Get and clear pending fill-level watermark notifications
+  \return       pending notifications (EventWatermarkHigh, EventWatermarkLow)
 */
-uint32_t EventRecorderStart (void) {
-  uint32_t ts;
+uint32_t EventRecorderWatermarkPending (void) {
+#if (EVENT_WATERMARK != 0)
+  uint32_t val;
 
-  if (EventStatus.state != 0U) {
-    //lint -e{904} "Return statement before end of function"
-    return 1U;
+  val = WatermarkPending;
+  while ((val != 0U) && (atomic_cmp_xch_32(&WatermarkPending, &val, 0U) == 0U)) {
+    ;
   }
-  EventStatus.state = 1U;
 
-#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
-  uint64_t ts64 = EventGetTS64();
-  EventRecord2_Log(ID_EVENT_START & EVENT_RECORD_ID_MASK, 0U, 0U, ts64);
-  ts = (uint32_t)ts64;
+  return val;
 #else
-  ts = EventGetTS();
+  return 0U;
 #endif
-
-  (void)EventRecordItem(ID_EVENT_START, ts, 0U, 0U);
-
-  return 1U;
 }
 
 /**
-  Stop event recording
+  Enable tracing of interrupt entry and exit
+  \param[in]    irqn   interrupt number (negative for system exceptions)
   \return       status (1=Success, 0=Failure)
 */
-uint32_t EventRecorderStop (void) {
-  uint32_t ts;
+uint32_t EventRecorderIrqTraceEnable (int32_t irqn) {
+#if (EVENT_IRQ_TRACING != 0)
+  EventIrqHandler_t handler;
+  uint32_t primask;
+  uint32_t vtor;
+  uint32_t n;
 
-  if (EventStatus.state == 0U) {
+  // Exception numbers 0 (stack pointer) and 1 (reset) are not traced
+  if ((irqn < -14) || (irqn >= ((int32_t)EVENT_IRQ_VECTORS - 16))) {
     //lint -e{904} "Return statement before end of function"
-    return 1U;
+    return 0U;
   }
-  EventStatus.state = 0U;
+  n = (uint32_t)(irqn + 16);
 
-#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
-  uint64_t ts64 = EventGetTS64();
-  EventRecord2_Log(ID_EVENT_STOP & EVENT_RECORD_ID_MASK, 0U, 0U, ts64);
-  ts = (uint32_t)ts64;
-#else
-  ts = EventGetTS();
-#endif
+  primask = __get_PRIMASK();
+  __disable_irq();
 
-  (void)EventRecordItem(ID_EVENT_STOP, ts, 0U, 0U);
+  // Relocate vector table to RAM when tracing is enabled first time
+  vtor = SCB->VTOR;
+  //lint -e{923} "cast from pointer to unsigned int"
+  if (vtor != (uint32_t)EventIrqVectors) {
+    //lint -e{923} "cast from unsigned int to pointer"
+    memcpy(EventIrqVectors, (const void *)vtor, sizeof(EventIrqVectors));
+    __DSB();
+    //lint -e{923} "cast from pointer to unsigned int"
+    SCB->VTOR = (uint32_t)EventIrqVectors;
+    __DSB();
+    __ISB();
+  } else {
+    vtor = 0U;
+  }
+
+  handler = EventIrqVectors[n];
+  if (handler != &EventIrqTrampoline) {
+    EventIrqHandlers[n] = handler;
+    EventIrqVectors[n]  = &EventIrqTrampoline;
+  } else {
+    handler = EventIrqHandlers[n];
+  }
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  // Events of table relocation and trace enable are recorded back-to-back:
+  // their time difference is the overhead of one event record in the trampoline
+  if (vtor != 0U) {
+    //lint -e{923} "cast from pointer to unsigned int"
+    EventIrqRecord(MID_EVENT_IRQ_TABLE, vtor, (uint32_t)EventIrqVectors);
+  }
+  //lint -e{923} "cast from pointer to unsigned int"
+  EventIrqRecord(MID_EVENT_IRQ_TRACE, n, (uint32_t)handler);
 
   return 1U;
+#else
+  (void)irqn;
+  return 0U;
+#endif
 }
 
 /**
-  Update Event Recorder timestamp clock
+  Disable tracing of interrupt entry and exit
+  \param[in]    irqn   interrupt number (negative for system exceptions)
   \return       status (1=Success, 0=Failure)
 */
-uint32_t EventRecorderClockUpdate (void) {
-  uint32_t ts;
+uint32_t EventRecorderIrqTraceDisable (int32_t irqn) {
+#if (EVENT_IRQ_TRACING != 0)
+  uint32_t primask;
+  uint32_t n;
 
-  EventStatus.ts_freq = EventRecorderTimerGetFreq();
+  if ((irqn < -14) || (irqn >= ((int32_t)EVENT_IRQ_VECTORS - 16))) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+  n = (uint32_t)(irqn + 16);
 
-#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
-  uint64_t ts64 = EventGetTS64();
-  EventRecord2_Log(ID_EVENT_CLOCK & EVENT_RECORD_ID_MASK, EventStatus.ts_freq, 0U, ts64);
-  ts = (uint32_t)ts64;
-#else
-  ts = EventGetTS();
-#endif
+  primask = __get_PRIMASK();
+  __disable_irq();
 
-  (void)EventRecordItem(ID_EVENT_CLOCK, ts, EventStatus.ts_freq, 0U);
+  //lint -e{923} "cast from pointer to unsigned int"
+  if ((SCB->VTOR == (uint32_t)EventIrqVectors) && (EventIrqVectors[n] == &EventIrqTrampoline)) {
+    EventIrqVectors[n] = EventIrqHandlers[n];
+  }
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
 
   return 1U;
+#else
+  (void)irqn;
+  return 0U;
+#endif
 }
 
 /**
@@ -1176,8 +3812,8 @@ uint32_t EventRecordData (uint32_t id, const void *data, uint32_t len) {
   //lint --e{934}  "Taking address of near auto variable"
   //lint --e{9016} "pointer arithmetic other than array indexing used"
   const uint8_t *dptr;
+  uint32_t thread;
   uint32_t ts;
-  uint32_t ctx;
   uint32_t val[2];
   uint32_t ret;
 
@@ -1186,26 +3822,30 @@ uint32_t EventRecordData (uint32_t id, const void *data, uint32_t len) {
     return 0U;
   }
 
-  if (EventCheckFilter(id) == 0U) {
+  if ((EventCheckFilter(id) == 0U) || (EventCheckValues(id, data, len) == 0U)) {
     //lint -e{904} "Return statement before end of function"
     return 1U;
   }
 
+  thread = EventThreadIndex();
+
 #ifdef RTE_CMSIS_View_EventRecorder_Semihosting
   uint64_t ts64 = EventGetTS64();
-  EventRecordData_Log(id, data, len, ts64);
+  EventRecordData_Log(id | (thread << EVENT_LOG_THREAD_POS), data, len, ts64);
   ts = (uint32_t)ts64;
 #else
   ts = EventGetTS();
 #endif
 
-  id &= EVENT_RECORD_ID_MASK;
+  id  = (id & EVENT_RECORD_ID_MASK) | EventPartition(id);
   id |= (__get_IPSR() != 0U) ? EVENT_RECORD_IRQ : 0U;
   //lint -e{9079} -e{9087} "conversion from pointer to void to pointer to other type"
   dptr = (const uint8_t *)data;
 
+  EventRepeatBreak();
+
   if (len == 0U) {
-    ret = EventRecordItem(id, ts, 0U, 0U);
+    ret = EventRecordItemThread(id, ts, 0U, 0U, thread);
     //lint -e{904} "Return statement before end of function"
     return (ret);
   }
@@ -1215,44 +3855,13 @@ uint32_t EventRecordData (uint32_t id, const void *data, uint32_t len) {
     val[1] = 0U;
     memcpy(val, dptr, len);
     id |= (len << EVENT_RECORD_DLEN_POS) & EVENT_RECORD_DLEN_MASK;
-    ret = EventRecordItem(id | EVENT_RECORD_FIRST | EVENT_RECORD_LAST, ts, val[0], val[1]);
+    ret = EventRecordItemThread(id | EVENT_RECORD_FIRST | EVENT_RECORD_LAST, ts, val[0], val[1], thread);
     //lint -e{904} "Return statement before end of function"
     return (ret);
   }
 
-  ctx = (GetContext() << EVENT_RECORD_CTX_POS) & EVENT_RECORD_CTX_MASK;
-
   memcpy(val, dptr, 8U);
-  dptr += 8U;
-  len  -= 8U;
-  id |= ctx;
-  ret = EventRecordItem(id | EVENT_RECORD_FIRST, ts, val[0], val[1]);
-  if (ret == 0U) {
-    //lint -e{904} "Return statement before end of function"
-    return 0U;
-  }
-
-  //lint -e{9044} "function parameter modified"
-  id = 0xFF01U | ctx;
-
-  while (len > 8U) {
-    memcpy(val, dptr, 8U);
-    dptr += 8U;
-    len  -= 8U;
-    ret = EventRecordItem(id, ts, val[0], val[1]);
-    id++;
-    if (ret == 0U) {
-      //lint -e{904} "Return statement before end of function"
-      return 0U;
-    }
-  }
-
-  val[0] = 0U;
-  val[1] = 0U;
-  memcpy(val, dptr, len);
-  id &= ~0xFF00U;
-  id |= len << 8;
-  ret = EventRecordItem(id | EVENT_RECORD_LAST, ts, val[0], val[1]);
+  ret = EventRecordChain(id, ts, val[0], val[1], dptr + 8U, len - 8U, thread);
 
   return (ret);
 }
@@ -1265,6 +3874,7 @@ uint32_t EventRecordData (uint32_t id, const void *data, uint32_t len) {
   \return       status (1=Success, 0=Failure)
 */
 uint32_t EventRecord2 (uint32_t id, uint32_t val1, uint32_t val2) {
+  uint32_t thread;
   uint32_t ts;
   uint32_t ret;
 
@@ -1273,18 +3883,60 @@ uint32_t EventRecord2 (uint32_t id, uint32_t val1, uint32_t val2) {
     return 1U;
   }
 
+#if (EVENT_PREDICATES != 0)
+  //lint -e{934} "Taking address of near auto variable"
+  const uint32_t val[2] = { val1, val2 };
+  if (EventCheckValues(id, val, sizeof(val)) == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return 1U;
+  }
+#endif
+
 #ifdef RTE_CMSIS_View_EventRecorder_Semihosting
   uint64_t ts64 = EventGetTS64();
-  EventRecord2_Log(id, val1, val2, ts64);
   ts = (uint32_t)ts64;
 #else
   ts = EventGetTS();
 #endif
 
-  id &= EVENT_RECORD_ID_MASK;
+#if (EVENT_STATISTICS != 0)
+  if ((id & 0xFF00U) == ((uint32_t)EvtStatistics_No << 8)) {
+    // Statistics events (durations, snapshots) are recorded after the repeats of the current context
+    EventRepeatBreak();
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+    EventStatisticsUpdate(id, ts64);
+#else
+    EventStatisticsUpdate(id, ts);
+#endif
+#if (EVENT_STATISTICS_RECORD != 1)
+    //lint -e{904} "Return statement before end of function"
+    return 1U;
+#endif
+  }
+#endif
+
+  thread = EventThreadIndex();
+
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+  EventRecord2_Log(id | (thread << EVENT_LOG_THREAD_POS), val1, val2, ts64);
+#endif
+
+  id  = (id & EVENT_RECORD_ID_MASK) | EventPartition(id);
   id |= (__get_IPSR() != 0U) ? EVENT_RECORD_IRQ : 0U;
 
-  ret = EventRecordItem(id | EVENT_RECORD_FIRST | EVENT_RECORD_LAST, ts, val1, val2);
+#if (EVENT_COALESCE != 0)
+  // Events of components 0xEF..0xFF (execution statistics, stdio, Event Recorder) are not coalesced
+  if ((id & 0xFF00U) < ((uint32_t)EvtStatistics_No << 8)) {
+    if (EventCoalesce(id, val1, val2, thread, ts) != 0U) {
+      //lint -e{904} "Return statement before end of function"
+      return 1U;
+    }
+  } else {
+    EventRepeatBreak();
+  }
+#endif
+
+  ret = EventRecordItemThread(id | EVENT_RECORD_FIRST | EVENT_RECORD_LAST, ts, val1, val2, thread);
 
   return (ret);
 }
@@ -1300,6 +3952,7 @@ uint32_t EventRecord2 (uint32_t id, uint32_t val1, uint32_t val2) {
 */
 uint32_t EventRecord4 (uint32_t id,
                        uint32_t val1, uint32_t val2, uint32_t val3, uint32_t val4) {
+  uint32_t thread;
   uint32_t ts;
   uint32_t ctx;
   uint32_t ret;
@@ -1309,24 +3962,220 @@ uint32_t EventRecord4 (uint32_t id,
     return 1U;
   }
 
+#if (EVENT_PREDICATES != 0)
+  //lint -e{934} "Taking address of near auto variable"
+  const uint32_t val[4] = { val1, val2, val3, val4 };
+  if (EventCheckValues(id, val, sizeof(val)) == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return 1U;
+  }
+#endif
+
+  thread = EventThreadIndex();
+
 #ifdef RTE_CMSIS_View_EventRecorder_Semihosting
   uint64_t ts64 = EventGetTS64();
-  EventRecord4_Log(id, val1, val2, val3, val4, ts64);
+  EventRecord4_Log(id | (thread << EVENT_LOG_THREAD_POS), val1, val2, val3, val4, ts64);
   ts = (uint32_t)ts64;
 #else
   ts = EventGetTS();
 #endif
 
-  id &= EVENT_RECORD_ID_MASK;
+  id  = (id & EVENT_RECORD_ID_MASK) | EventPartition(id);
   id |= (__get_IPSR() != 0U) ? EVENT_RECORD_IRQ : 0U;
   ctx = (GetContext() << EVENT_RECORD_CTX_POS) & EVENT_RECORD_CTX_MASK;
 
-  ret = EventRecordItem(id | ctx | EVENT_RECORD_FIRST, ts, val1, val2);
+  EventRepeatBreak();
+
+  ret = EventRecordItemThread(id | ctx | EVENT_RECORD_FIRST, ts, val1, val2, thread);
   if (ret == 0U) {
     //lint -e{904} "Return statement before end of function"
     return 0U;
   }
-  ret = EventRecordItem(1U | ctx | EVENT_RECORD_LAST,  ts, val3, val4);
+  ret = EventRecordItem(1U | ctx | EVENT_RECORD_LAST | (id & EVENT_RECORD_PART), ts, val3, val4);
+
+  return (ret);
+}
+
+/**
+  Record an event for extended execution statistics
+  \param[in]    mid    message number (MID_EVENT_STAT_xxx)
+  \param[in]    handle handle of measurement point
+  \param[in]    val    data value
+  \return       status (1=Success, 0=Failure)
+*/
+static uint32_t EventRecordStatistics (uint32_t mid, uint32_t handle, uint32_t val) {
+  uint32_t thread;
+  uint32_t ts;
+  uint32_t id;
+  uint32_t ret;
+
+  // Extended statistics are filtered with level Op of the statistics component
+  if (EventCheckFilter(EventID(EventLevelOp, EvtStatistics_No, 0U)) == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return 1U;
+  }
+
+  id     = ((uint32_t)CID_EVENT << 8) | mid;
+  thread = EventThreadIndex();
+
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+  uint64_t ts64 = EventGetTS64();
+  EventRecord2_Log(id | (thread << EVENT_LOG_THREAD_POS), handle, val, ts64);
+  ts = (uint32_t)ts64;
+#else
+  ts = EventGetTS();
+#endif
+
+  id |= (__get_IPSR() != 0U) ? EVENT_RECORD_IRQ : 0U;
+
+  EventRepeatBreak();
+
+  ret = EventRecordItemThread(id | EVENT_RECORD_FIRST | EVENT_RECORD_LAST, ts, handle, val, thread);
+
+  return (ret);
+}
+
+/**
+  Register a measurement point for extended execution statistics
+  \param[in]    name   name of measurement point
+  \return       handle (1..65535), 0=Failure
+*/
+uint32_t EventStatisticsRegister (const char *name) {
+  uint32_t handle;
+
+  handle = atomic_inc_32(&StatisticsHandle) + 1U;
+  if (handle > 0xFFFFU) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+
+  //lint -e{923} "cast from pointer to unsigned int"
+  (void)EventRecordStatistics(MID_EVENT_STAT_REG, handle, (uint32_t)name);
+
+  return (handle);
+}
+
+/**
+  Record start event for extended execution statistics
+  \param[in]    handle handle of measurement point
+  \param[in]    val    data value
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventStatisticsStart (uint32_t handle, uint32_t val) {
+
+  if ((handle == 0U) || (handle > 0xFFFFU)) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+
+  return (EventRecordStatistics(MID_EVENT_STAT_START, handle, val));
+}
+
+/**
+  Record stop event for extended execution statistics
+  \param[in]    handle handle of measurement point
+  \param[in]    val    data value
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventStatisticsStop (uint32_t handle, uint32_t val) {
+
+  if ((handle == 0U) || (handle > 0xFFFFU)) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+
+  return (EventRecordStatistics(MID_EVENT_STAT_STOP, handle, val));
+}
+
+/**
+  Get a new transfer identifier for fragmented event data
+  \return       transfer identifier (16-bit)
+*/
+uint32_t EventRecordTransferID (void) {
+  return (atomic_inc_32(&TransferID) & 0xFFFFU);
+}
+
+/**
+  Record a fragment of an event with large data size
+  \param[in]    id      event identifier (level, component number, message number)
+  \param[in]    xfer    transfer identifier
+  \param[in]    total   total length of event data (max 65535 bytes)
+  \param[in]    offset  offset of fragment data within event data
+  \param[in]    data    fragment data buffer
+  \param[in]    len     fragment data length
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventRecordFragment (uint32_t id, uint32_t xfer, uint32_t total, uint32_t offset,
+                              const void *data, uint32_t len) {
+  //lint --e{9016} "pointer arithmetic other than array indexing used"
+  const uint8_t *dptr;
+  uint32_t thread;
+  uint32_t ts;
+  uint32_t cnt;
+  uint32_t ret;
+
+  if ((data == NULL) || (len == 0U) || (total > EVENT_FRAG_MAX_TOTAL) ||
+      (offset > total)   || (len > (total - offset))) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+
+  if (EventCheckFilter(id) == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return 1U;
+  }
+
+  id = (id & EVENT_RECORD_ID_MASK) | EventPartition(id);
+  //lint -e{9079} -e{9087} "conversion from pointer to void to pointer to other type"
+  dptr = (const uint8_t *)data;
+  thread = EventThreadIndex();
+  EventRepeatBreak();
+
+  do {
+    cnt = (len > EVENT_FRAG_MAX_LENGTH) ? EVENT_FRAG_MAX_LENGTH : len;
+
+#ifdef RTE_CMSIS_View_EventRecorder_Semihosting
+    uint64_t ts64 = EventGetTS64();
+    EventRecordFrag_Log(id | (thread << EVENT_LOG_THREAD_POS), xfer, total, offset, dptr, cnt, ts64);
+    ts = (uint32_t)ts64;
+#else
+    ts = EventGetTS();
+#endif
+
+    ret = EventRecordChain(id | ((__get_IPSR() != 0U) ? EVENT_RECORD_IRQ : 0U), ts,
+                           (xfer & 0xFFFFU) | (total << 16), offset, dptr, cnt, thread);
+    if (ret == 0U) {
+      break;
+    }
+    dptr   += cnt;
+    //lint -e{9044} "function parameter modified"
+    offset += cnt;
+    len    -= cnt;
+  } while (len != 0U);
 
   return (ret);
 }
+
+/**
+  Record an event with large data size (split into fragments)
+  \param[in]    id     event identifier (level, component number, message number)
+  \param[in]    data   event data buffer
+  \param[in]    len    event data length (max 65535 bytes)
+  \return       status (1=Success, 0=Failure)
+*/
+uint32_t EventRecordDataLarge (uint32_t id, const void *data, uint32_t len) {
+
+  if (len <= EVENT_DATA_MAX_LENGTH) {
+    //lint -e{904} "Return statement before end of function"
+    return (EventRecordData(id, data, len));
+  }
+
+  // Value predicates apply to the complete data (event filter is checked by EventRecordFragment)
+  if (EventCheckValues(id, data, len) == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return 1U;
+  }
+
+  return (EventRecordFragment(id, EventRecordTransferID(), len, 0U, data, len));
+}
@@ -19,12 +19,17 @@
 package main
 
 import (
+	"eventlist/pkg/codegen"
+	"eventlist/pkg/control"
+	"eventlist/pkg/dump"
 	"eventlist/pkg/elf"
 	"eventlist/pkg/output"
+	"eventlist/pkg/swo"
 	"eventlist/pkg/xml/scvd"
 	"flag"
 	"fmt"
 	"os"
+	"strconv"
 	"strings"
 )
 
@@ -77,6 +82,63 @@ func infoOpt(flags *flag.FlagSet, sopt string, lopt string, opt string) {
 	}
 }
 
+// decode the Event Buffer of a memory image into a temporary log file
+func decodeImage(imageFile *string, addr *string) (string, error) {
+	base, err := strconv.ParseUint(*addr, 0, 32)
+	if err != nil {
+		return "", err
+	}
+	img, err := dump.ReadImage(imageFile, base)
+	if err != nil {
+		return "", err
+	}
+	file, err := os.CreateTemp("", "eventlist*.log")
+	if err != nil {
+		return "", err
+	}
+	res, err := dump.Decode(img, file)
+	file.Close()
+	if err != nil {
+		os.Remove(file.Name())
+		return "", err
+	}
+	if res.Freq != 0 {
+		output.TimeFactor = new(float64)
+		*output.TimeFactor = 1.0 / float64(res.Freq)
+	}
+	if res.Discarded != 0 {
+		fmt.Fprintf(os.Stderr, "%s: %d event records discarded (overwritten or incomplete)\n", Progname, res.Discarded)
+	}
+	return file.Name(), nil
+}
+
+// decode the events of a SWO capture into a temporary log file
+func decodeSWO(swoFile *string, port *string) (string, error) {
+	n, err := strconv.ParseUint(*port, 0, 8)
+	if err != nil {
+		return "", err
+	}
+	in, err := os.Open(*swoFile)
+	if err != nil {
+		return "", err
+	}
+	defer in.Close()
+	file, err := os.CreateTemp("", "eventlist*.log")
+	if err != nil {
+		return "", err
+	}
+	res, err := swo.Decode(in, file, int(n))
+	file.Close()
+	if err != nil {
+		os.Remove(file.Name())
+		return "", err
+	}
+	if res.Discarded != 0 || res.Overflows != 0 {
+		fmt.Fprintf(os.Stderr, "%s: %d event records discarded (%d ITM overflows)\n", Progname, res.Discarded, res.Overflows)
+	}
+	return file.Name(), nil
+}
+
 func main() {
 	var err error
 	Progname = os.Args[0]
@@ -116,6 +178,10 @@ func main() {
 		infoOpt(commFlag, "s", "statistic", "")
 		infoOpt(commFlag, "V", "version", "")
 		infoOpt(commFlag, "f", "format", "<formatType>")
+		infoOpt(commFlag, "g", "", "<fileName>")
+		infoOpt(commFlag, "m", "", "<address>")
+		infoOpt(commFlag, "p", "", "<port>")
+		infoOpt(commFlag, "c", "", "<commands>")
 		usage = true
 	}
 	// parse command line
@@ -123,6 +189,10 @@ func main() {
 	outputFile := commFlag.String("o", "", "output file name")
 	elfFile := commFlag.String("a", "", "elf/axf file name")
 	formatType := commFlag.String("f", "", "format type: txt, json, xml")
+	genFile := commFlag.String("g", "", "generate C header file with event functions from SCVD files")
+	imageAddr := commFlag.String("m", "", "input file is a memory image (RAM dump) at start address, requires -a")
+	swoPort := commFlag.String("p", "", "input file is a SWO capture with events on ITM stimulus ports <port> and <port>+1")
+	ctrlCmds := commFlag.String("c", "", "encode control commands separated by ';' for the Event Recorder control channel into the output file or device")
 	var statBegin bool
 	commFlag.BoolVar(&statBegin, "b", false, "show statistic at beginning")
 	commFlag.BoolVar(&statBegin, "begin", false, "show statistic at beginning")
@@ -143,6 +213,22 @@ func main() {
 		return
 	}
 
+	if len(*genFile) != 0 {
+		if err = codegen.Header(genFile, paths); err != nil {
+			fmt.Print(Progname + ": ")
+			fmt.Println(err)
+		}
+		return
+	}
+
+	if len(*ctrlCmds) != 0 {
+		if err = control.Write(outputFile, *ctrlCmds); err != nil {
+			fmt.Print(Progname + ": ")
+			fmt.Println(err)
+		}
+		return
+	}
+
 	eventFile := commFlag.Args()
 
 	if len(eventFile) == 0 {
@@ -161,6 +247,26 @@ func main() {
 			return
 		}
 	}
+	if len(*imageAddr) != 0 {
+		if elfFile == nil || len(*elfFile) == 0 {
+			fmt.Println(Progname + ": memory image requires elf/axf file")
+			return
+		}
+		if eventFile[0], err = decodeImage(&eventFile[0], imageAddr); err != nil {
+			fmt.Print(Progname + ": ")
+			fmt.Println(err)
+			return
+		}
+		defer os.Remove(eventFile[0])
+	} else if len(*swoPort) != 0 {
+		if eventFile[0], err = decodeSWO(&eventFile[0], swoPort); err != nil {
+			fmt.Print(Progname + ": ")
+			fmt.Println(err)
+			return
+		}
+		defer os.Remove(eventFile[0])
+	}
+
 	evdefs := make(map[uint16]scvd.Event)
 	typedefs := make(map[string]map[string]map[int16]string)
 
@@ -183,6 +183,15 @@ func Test_main(t *testing.T) { //nolint:golint,paralleltest
 		{"-version", []string{"-version"}, ".* [0-9]+\\.[0-9]+\\.[0-9]+ \\(C\\) [0-9]+ Arm Ltd. and Contributors\\n", ""},
 		{"err", []string{"xxx", "yyy"}, ".*: only one binary input file allowed\n", ""},
 		{"missing", nil, ".*: missing input file\n", ""},
+		{"-g", []string{"-I", "../../testdata/test_gen.xml", "-g", outFile}, "", outFile},
+		{"-m", []string{"-m", "0x20000000", "../../testdata/test22.dump"}, ".*: memory image requires elf/axf file\n", ""},
+		{"-m addr", []string{"-a", "../../testdata/elfsym.elf", "-m", "x", "../../testdata/test22.dump"}, ".*: strconv.ParseUint: parsing \"x\": invalid syntax\n", ""},
+		{"-m info", []string{"-a", "../../testdata/elfsym.elf", "-m", "0x20000000", "../../testdata/test22.dump"}, ".*: EventRecorderInfo not found\n", ""},
+		{"-p", []string{"-p", "8", "-o", outFile, "../../testdata/test24.swo"}, "", outFile},
+		{"-p port", []string{"-p", "x", "../../testdata/test24.swo"}, ".*: strconv.ParseUint: parsing \"x\": invalid syntax\n", ""},
+		{"-p range", []string{"-p", "31", "../../testdata/test24.swo"}, ".*: invalid ITM stimulus port: 31\n", ""},
+		{"-c", []string{"-c", "disable all 0 0xFE; enable error 0 0xFE; start", "-o", outFile}, "", outFile},
+		{"-c cmd", []string{"-c", "reset"}, ".*: invalid control command: reset\n", ""},
 		// -I must be the last test
 		{"-I", []string{"-I", "../../testdata/nix", "xxx"}, ".*: open ../../testdata/nix: (no such file or directory|The system cannot find the file specified.)\\n", ""},
 	}
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Package codegen generates C event functions from SCVD event definitions.
+package codegen
+
+import (
+	"bufio"
+	"errors"
+	"eventlist/pkg/xml/scvd"
+	"fmt"
+	"os"
+	"path/filepath"
+	"regexp"
+	"sort"
+	"strings"
+)
+
+var ErrLevel = errors.New("invalid event level")
+
+// kind of the record function
+const (
+	record2    = iota // EventRecord2 with up to 2 values
+	record4           // EventRecord4 with up to 4 values
+	recordText        // EventRecordData with a text string
+	recordData        // EventRecordData with a data buffer
+)
+
+type function struct {
+	name  string
+	id    uint16
+	level string
+	kind  int
+	args  [4]string // C type of val1..val4, empty if not used
+	event scvd.Event
+}
+
+var levels = map[string]string{
+	"Error":  "EventLevelError",
+	"API":    "EventLevelAPI",
+	"Op":     "EventLevelOp",
+	"Detail": "EventLevelDetail",
+}
+
+// format specifier with expression, e.g. %d[val1] or %I[val1, NetAddr:addr]
+var reFormat = regexp.MustCompile(`%([a-zA-Z])\[([^\]]*)\]`)
+var reVal = regexp.MustCompile(`\bval([1-4])\b`)
+var reIdent = regexp.MustCompile(`[^A-Za-z0-9]+`)
+
+// convert a text to a C identifier part
+func ident(s string) string {
+	return strings.Trim(reIdent.ReplaceAllString(s, "_"), "_")
+}
+
+// analyze the value format of an event: record function and types of the values
+func (f *function) analyze() {
+	for _, m := range reFormat.FindAllStringSubmatch(string(f.event.Value), -1) {
+		spec, expr := m[1], m[2]
+		for _, v := range reVal.FindAllStringSubmatch(expr, -1) {
+			n := v[1][0] - '1'
+			switch {
+			case spec == "t" || spec == "U":
+				f.kind = recordText
+			case strings.Contains(expr, ":"): // member of a typedef
+				f.kind = recordData
+			case spec == "N" || spec == "S":
+				f.args[n] = "const void *"
+			case spec == "d" && f.args[n] == "":
+				f.args[n] = "int32_t"
+			case f.args[n] == "":
+				f.args[n] = "uint32_t"
+			}
+		}
+	}
+	if f.kind == recordText || f.kind == recordData {
+		f.args = [4]string{}
+		return
+	}
+	if f.args[2] != "" || f.args[3] != "" {
+		f.kind = record4
+	}
+}
+
+// get the value argument of the record function, values not used by the event are 0
+func (f *function) val(n int) string {
+	switch f.args[n] {
+	case "":
+		return "0U"
+	case "uint32_t":
+		return fmt.Sprintf("val%d", n+1)
+	}
+	return fmt.Sprintf("(uint32_t)val%d", n+1)
+}
+
+func (f *function) params() string {
+	switch f.kind {
+	case recordText:
+		return "const char *str"
+	case recordData:
+		return "const void *data, uint32_t len"
+	}
+	var params []string
+	for n, t := range f.args {
+		if t != "" {
+			if strings.HasSuffix(t, "*") {
+				params = append(params, fmt.Sprintf("%sval%d", t, n+1))
+			} else {
+				params = append(params, fmt.Sprintf("%s val%d", t, n+1))
+			}
+		}
+	}
+	if len(params) == 0 {
+		return "void"
+	}
+	return strings.Join(params, ", ")
+}
+
+func (f *function) call() string {
+	id := fmt.Sprintf("EventID(%s, 0x%02XU, 0x%02XU)", f.level, f.id>>8, f.id&0xFF)
+	switch f.kind {
+	case recordText:
+		return fmt.Sprintf("EventRecordData(%s, str, (uint32_t)strlen(str))", id)
+	case recordData:
+		return fmt.Sprintf("EventRecordData(%s, data, len)", id)
+	case record4:
+		return fmt.Sprintf("EventRecord4(%s, %s, %s, %s, %s)", id, f.val(0), f.val(1), f.val(2), f.val(3))
+	}
+	return fmt.Sprintf("EventRecord2(%s, %s, %s)", id, f.val(0), f.val(1))
+}
+
+// escape end of comment in texts taken from SCVD
+func comment(s string) string {
+	return strings.ReplaceAll(s, "*/", "* /")
+}
+
+func getFunctions(scvdFiles []string) ([]function, map[uint8]*scvd.GroupComponent, error) {
+	var funcs []function
+	components := make(map[uint8]*scvd.GroupComponent)
+	for i := range scvdFiles {
+		viewer, err := scvd.Load(&scvdFiles[i])
+		if err != nil {
+			return nil, nil, err
+		}
+		comps, err := viewer.Components()
+		if err != nil {
+			return nil, nil, err
+		}
+		for no, c := range comps {
+			components[no] = c
+		}
+		for _, ev := range viewer.Events.Events {
+			id, err := ev.ID.Value()
+			if err != nil {
+				return nil, nil, err
+			}
+			switch id >> 8 {
+			case 0xEF, 0xFE, 0xFF: // recorded by the Event Recorder itself
+				continue
+			}
+			level, ok := levels[ev.Level]
+			if !ok {
+				return nil, nil, fmt.Errorf("%w: event 0x%04X level \"%s\"", ErrLevel, id, ev.Level)
+			}
+			f := function{id: id, level: level, event: ev}
+			f.analyze()
+			funcs = append(funcs, f)
+		}
+	}
+	sort.SliceStable(funcs, func(i, j int) bool { return funcs[i].id < funcs[j].id })
+
+	// function name: Evr<component>_<property>, events with the same property get the message number appended
+	names := make(map[string]int)
+	for i := range funcs {
+		f := &funcs[i]
+		comp := fmt.Sprintf("%02X", f.id>>8)
+		if c, ok := components[uint8(f.id>>8)]; ok {
+			switch {
+			case ident(c.Brief) != "":
+				comp = ident(c.Brief)
+			case ident(c.Name) != "":
+				comp = ident(c.Name)
+			}
+		}
+		f.name = "Evr" + comp + "_" + ident(f.event.Property)
+		names[f.name]++
+	}
+	for i := range funcs {
+		f := &funcs[i]
+		if names[f.name] > 1 {
+			f.name = fmt.Sprintf("%s_%02X", f.name, f.id&0xFF)
+		}
+	}
+	return funcs, components, nil
+}
+
+// Header generates a C header file with static inline event functions for the events of the SCVD files
+func Header(filename *string, scvdFiles []string) error {
+	funcs, components, err := getFunctions(scvdFiles)
+	if err != nil {
+		return err
+	}
+
+	file, err := os.Create(*filename)
+	if err != nil {
+		return err
+	}
+	defer file.Close()
+	out := bufio.NewWriter(file)
+
+	guard := "__" + strings.ToUpper(ident(filepath.Base(*filename)))
+	inputs := make([]string, len(scvdFiles))
+	for i := range scvdFiles {
+		inputs[i] = filepath.Base(scvdFiles[i])
+	}
+	text := false
+	for i := range funcs {
+		text = text || funcs[i].kind == recordText
+	}
+
+	fmt.Fprintf(out, "/* Event functions generated by eventlist from %s - do not edit */\n\n", comment(strings.Join(inputs, ", ")))
+	fmt.Fprintf(out, "#ifndef %s\n#define %s\n\n", guard, guard)
+	fmt.Fprintf(out, "#include <stdint.h>\n")
+	if text {
+		fmt.Fprintf(out, "#include <string.h>\n")
+	}
+	fmt.Fprintf(out, "#include \"EventRecorder.h\"\n\n")
+	fmt.Fprintf(out, "#ifdef __cplusplus\nextern \"C\" {\n#endif\n")
+
+	comp := -1
+	for i := range funcs {
+		f := &funcs[i]
+		if int(f.id>>8) != comp {
+			comp = int(f.id >> 8)
+			if c, ok := components[uint8(comp)]; ok {
+				fmt.Fprintf(out, "\n// %s (component number 0x%02X)\n", comment(c.Name), comp)
+			} else {
+				fmt.Fprintf(out, "\n// Component number 0x%02X\n", comp)
+			}
+		}
+		fmt.Fprintf(out, "\n/// Event %s", comment(f.event.Property))
+		if f.event.Value != "" {
+			fmt.Fprintf(out, ": %s", comment(string(f.event.Value)))
+		}
+		fmt.Fprintf(out, "\n")
+		if f.event.Info != "" {
+			fmt.Fprintf(out, "/// %s\n", comment(f.event.Info))
+		}
+		fmt.Fprintf(out, "static inline uint32_t %s (%s) {\n", f.name, f.params())
+		fmt.Fprintf(out, "  return %s;\n}\n", f.call())
+	}
+
+	fmt.Fprintf(out, "\n#ifdef __cplusplus\n}\n#endif\n\n#endif /* %s */\n", guard)
+	return out.Flush()
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package codegen
+
+import (
+	"errors"
+	"eventlist/pkg/xml/scvd"
+	"os"
+	"path/filepath"
+	"strings"
+	"testing"
+)
+
+func Test_ident(t *testing.T) {
+	t.Parallel()
+
+	tests := []struct {
+		s    string
+		want string
+	}{
+		{"StartA(0)", "StartA_0"},
+		{"Send", "Send"},
+		{"My Component", "My_Component"},
+		{"(x)", "x"},
+	}
+	for _, tt := range tests {
+		if got := ident(tt.s); got != tt.want {
+			t.Errorf("ident(%q) = %q, want %q", tt.s, got, tt.want)
+		}
+	}
+}
+
+func Test_function_analyze(t *testing.T) {
+	t.Parallel()
+
+	tests := []struct {
+		name   string
+		value  string
+		kind   int
+		params string
+		call   string
+	}{
+		{"none", "", record2, "void", "EventRecord2(EventID(EventLevelOp, 0x0AU, 0x01U), 0U, 0U)"},
+		{"val1", "a=%x[val1]", record2, "uint32_t val1", "EventRecord2(EventID(EventLevelOp, 0x0AU, 0x01U), val1, 0U)"},
+		{"signed", "a=%d[val2]", record2, "int32_t val2", "EventRecord2(EventID(EventLevelOp, 0x0AU, 0x01U), 0U, (uint32_t)val2)"},
+		{"expr", "%x[(uint8_t)(val1 >> 8)] %d[val1]", record2, "uint32_t val1", "EventRecord2(EventID(EventLevelOp, 0x0AU, 0x01U), val1, 0U)"},
+		{"name", "n=%N[val1] v=%u[val3]", record4, "const void *val1, uint32_t val3",
+			"EventRecord4(EventID(EventLevelOp, 0x0AU, 0x01U), (uint32_t)val1, 0U, val3, 0U)"},
+		{"text", "s=%t[val1]", recordText, "const char *str", "EventRecordData(EventID(EventLevelOp, 0x0AU, 0x01U), str, (uint32_t)strlen(str))"},
+		{"typedef", "ip=%I[val1, NetAddr:addr]", recordData, "const void *data, uint32_t len", "EventRecordData(EventID(EventLevelOp, 0x0AU, 0x01U), data, len)"},
+	}
+	for _, tt := range tests {
+		tt := tt
+		t.Run(tt.name, func(t *testing.T) {
+			t.Parallel()
+
+			f := function{id: 0x0A01, level: "EventLevelOp", event: scvd.Event{Value: scvd.Value(tt.value)}}
+			f.analyze()
+			if f.kind != tt.kind {
+				t.Errorf("function.analyze() %s kind = %d, want %d", tt.name, f.kind, tt.kind)
+			}
+			if got := f.params(); got != tt.params {
+				t.Errorf("function.params() %s = %q, want %q", tt.name, got, tt.params)
+			}
+			if got := f.call(); got != tt.call {
+				t.Errorf("function.call() %s = %q, want %q", tt.name, got, tt.call)
+			}
+		})
+	}
+}
+
+func TestHeader(t *testing.T) {
+	t.Parallel()
+
+	out := filepath.Join(t.TempDir(), "EvrMyComp.h")
+	if err := Header(&out, []string{"../../testdata/test_gen.xml"}); err != nil {
+		t.Fatalf("Header() error = %v", err)
+	}
+	buf, err := os.ReadFile(out)
+	if err != nil {
+		t.Fatalf("Header() output: %v", err)
+	}
+	for _, want := range []string{
+		"#ifndef __EVRMYCOMP_H\n",
+		"#include <string.h>\n",
+		"static inline uint32_t EvrMyComp_Init (void) {\n  return EventRecord2(EventID(EventLevelAPI, 0x0AU, 0x00U), 0U, 0U);\n}\n",
+		"static inline uint32_t EvrMyComp_Send (uint32_t val1, int32_t val2) {\n",
+		"static inline uint32_t EvrMyComp_Error (const void *data, uint32_t len) {\n",
+		"static inline uint32_t EvrMyComp_Name (const char *str) {\n",
+		"static inline uint32_t EvrMyComp_State_04 (const void *val1, uint32_t val4) {\n",
+		"static inline uint32_t EvrMyComp_State_05 (uint32_t val2) {\n",
+	} {
+		if !strings.Contains(string(buf), want) {
+			t.Errorf("Header() output missing %q", want)
+		}
+	}
+
+	// events of the Event Recorder are not generated
+	out2 := filepath.Join(t.TempDir(), "evr.h")
+	if err := Header(&out2, []string{"../../testdata/test.xml"}); err != nil {
+		t.Fatalf("Header() error = %v", err)
+	}
+	if buf, _ = os.ReadFile(out2); strings.Contains(string(buf), "static inline") {
+		t.Errorf("Header() generated functions for Event Recorder events")
+	}
+}
+
+func TestHeader_err(t *testing.T) {
+	t.Parallel()
+
+	dir := t.TempDir()
+	in := filepath.Join(dir, "lvl.xml")
+	data := `<component_viewer><events><event id="0x0100" level="Info" property="X"/></events></component_viewer>`
+	if err := os.WriteFile(in, []byte(data), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	out := filepath.Join(dir, "out.h")
+	if err := Header(&out, []string{in}); !errors.Is(err, ErrLevel) {
+		t.Errorf("Header() error = %v, want %v", err, ErrLevel)
+	}
+	nix := "../../testdata/nix"
+	if err := Header(&out, []string{nix}); err == nil {
+		t.Errorf("Header() missing file: no error")
+	}
+}
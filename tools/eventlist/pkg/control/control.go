@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Package control encodes commands for the control channel of the Event Recorder
+// (EventRecorderControl and the control mailbox) from a textual command list.
+package control
+
+import (
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"io"
+	"os"
+	"strconv"
+	"strings"
+)
+
+var ErrCommand = errors.New("invalid control command")
+var ErrArgument = errors.New("invalid control command argument")
+
+// Length of an encoded command in bytes
+const Length = 8
+
+// Commands (byte 0 of an encoded command)
+const (
+	cmdEnable     = 0x01 // [1]=level mask, [2]=first component, [3]=last component
+	cmdDisable    = 0x02 // [1]=level mask, [2]=first component, [3]=last component
+	cmdStart      = 0x03
+	cmdStop       = 0x04
+	cmdTrigger    = 0x05 // [1..2]=number of events after the trigger event, [4..7]=event identifier
+	cmdTriggerOff = 0x06
+	cmdPeriod     = 0x07 // [4..7]=snapshot period of execution statistics in ms
+)
+
+// Limits of command arguments
+const (
+	maxComponent = 0xFE
+	maxID        = 0x3FFFF
+	maxCount     = 0xFFFF
+	maxPeriod    = 3600000
+)
+
+// level names for the level mask of enable and disable
+var levels = map[string]uint64{
+	"error":  0x01,
+	"api":    0x02,
+	"op":     0x04,
+	"detail": 0x08,
+	"all":    0x0F,
+}
+
+// parse a numeric argument (decimal, 0x hexadecimal) with maximum value
+func number(s string, max uint64) (uint64, error) {
+	v, err := strconv.ParseUint(s, 0, 32)
+	if err != nil || v > max {
+		return 0, fmt.Errorf("%w: %s", ErrArgument, s)
+	}
+	return v, nil
+}
+
+// parse a level mask: number or level names combined with '+'
+func level(s string) (uint64, error) {
+	var mask uint64
+	for _, name := range strings.Split(strings.ToLower(s), "+") {
+		v, ok := levels[name]
+		if !ok {
+			return number(s, 0x0F)
+		}
+		mask |= v
+	}
+	return mask, nil
+}
+
+// encode one command with its arguments
+func encode(args []string) ([]uint8, error) {
+	cmd := make([]uint8, Length)
+	var v [3]uint64
+	var err error
+
+	switch strings.ToLower(args[0]) {
+	case "enable", "disable":
+		if len(args) != 4 {
+			return nil, fmt.Errorf("%w: %s <level> <first> <last>", ErrCommand, args[0])
+		}
+		if v[0], err = level(args[1]); err != nil {
+			return nil, err
+		}
+		for i := 1; i < 3; i++ {
+			if v[i], err = number(args[i+1], maxComponent); err != nil {
+				return nil, err
+			}
+		}
+		if v[1] > v[2] {
+			return nil, fmt.Errorf("%w: %s > %s", ErrArgument, args[2], args[3])
+		}
+		cmd[0] = cmdEnable
+		if strings.ToLower(args[0]) == "disable" {
+			cmd[0] = cmdDisable
+		}
+		cmd[1], cmd[2], cmd[3] = uint8(v[0]), uint8(v[1]), uint8(v[2])
+	case "start", "stop":
+		if len(args) != 1 {
+			return nil, fmt.Errorf("%w: %s", ErrCommand, strings.Join(args, " "))
+		}
+		cmd[0] = cmdStart
+		if strings.ToLower(args[0]) == "stop" {
+			cmd[0] = cmdStop
+		}
+	case "trigger":
+		if len(args) == 2 && strings.ToLower(args[1]) == "off" {
+			cmd[0] = cmdTriggerOff
+			break
+		}
+		if len(args) < 2 || len(args) > 3 {
+			return nil, fmt.Errorf("%w: trigger <id> [<count>] | trigger off", ErrCommand)
+		}
+		if v[0], err = number(args[1], maxID); err != nil {
+			return nil, err
+		}
+		if len(args) == 3 {
+			if v[1], err = number(args[2], maxCount); err != nil {
+				return nil, err
+			}
+		}
+		cmd[0] = cmdTrigger
+		binary.LittleEndian.PutUint16(cmd[1:3], uint16(v[1]))
+		binary.LittleEndian.PutUint32(cmd[4:8], uint32(v[0]))
+	case "period":
+		if len(args) != 2 {
+			return nil, fmt.Errorf("%w: period <ms>", ErrCommand)
+		}
+		if v[0], err = number(args[1], maxPeriod); err != nil {
+			return nil, err
+		}
+		cmd[0] = cmdPeriod
+		binary.LittleEndian.PutUint32(cmd[4:8], uint32(v[0]))
+	default:
+		return nil, fmt.Errorf("%w: %s", ErrCommand, args[0])
+	}
+	return cmd, nil
+}
+
+// Encode translates commands separated by ';' or new lines into the
+// binary command format (Length bytes per command) of EventRecorderControl
+func Encode(s string) ([]uint8, error) {
+	var out []uint8
+
+	for _, line := range strings.FieldsFunc(s, func(r rune) bool { return r == ';' || r == '\n' }) {
+		args := strings.Fields(line)
+		if len(args) == 0 {
+			continue
+		}
+		cmd, err := encode(args)
+		if err != nil {
+			return nil, err
+		}
+		out = append(out, cmd...)
+	}
+	if len(out) == 0 {
+		return nil, fmt.Errorf("%w: no command", ErrCommand)
+	}
+	return out, nil
+}
+
+// Write encodes commands and writes them to the file or device name
+// (for example a serial port of the target), or to standard output when name is empty
+func Write(name *string, s string) error {
+	var out io.Writer = os.Stdout
+
+	cmds, err := Encode(s)
+	if err != nil {
+		return err
+	}
+	if name != nil && len(*name) != 0 {
+		file, err := os.OpenFile(*name, os.O_WRONLY|os.O_CREATE|os.O_TRUNC, 0666)
+		if err != nil {
+			return err
+		}
+		defer file.Close()
+		out = file
+	}
+	_, err = out.Write(cmds)
+	return err
+}
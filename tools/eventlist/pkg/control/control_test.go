@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package control
+
+import (
+	"bytes"
+	"errors"
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+func TestEncode(t *testing.T) {
+	t.Parallel()
+
+	tests := []struct {
+		name    string
+		s       string
+		want    []uint8
+		wantErr error
+	}{
+		{"enable", "enable 0x0F 0x80 0x8F", []uint8{1, 0x0F, 0x80, 0x8F, 0, 0, 0, 0}, nil},
+		{"disable names", "disable api+detail 0 254", []uint8{2, 0x0A, 0x00, 0xFE, 0, 0, 0, 0}, nil},
+		{"start stop", "stop; start", []uint8{4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0}, nil},
+		{"trigger", "TRIGGER 0x18A05 300", []uint8{5, 0x2C, 0x01, 0, 0x05, 0x8A, 0x01, 0}, nil},
+		{"trigger default", "trigger 0xEF00", []uint8{5, 0, 0, 0, 0x00, 0xEF, 0, 0}, nil},
+		{"trigger off", "trigger off", []uint8{6, 0, 0, 0, 0, 0, 0, 0}, nil},
+		{"period", "period 100000", []uint8{7, 0, 0, 0, 0xA0, 0x86, 0x01, 0}, nil},
+		{"lines", "\n start \n\n period 0 \n", []uint8{3, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0}, nil},
+		{"empty", " ; ", nil, ErrCommand},
+		{"unknown", "reset", nil, ErrCommand},
+		{"enable args", "enable all 0x10", nil, ErrCommand},
+		{"start args", "start 1", nil, ErrCommand},
+		{"trigger args", "trigger", nil, ErrCommand},
+		{"period args", "period", nil, ErrCommand},
+		{"level", "enable warn 0 1", nil, ErrArgument},
+		{"level range", "enable 0x10 0 1", nil, ErrArgument},
+		{"component", "enable all 0 0xFF", nil, ErrArgument},
+		{"component order", "disable all 0x20 0x10", nil, ErrArgument},
+		{"trigger id", "trigger 0x40000", nil, ErrArgument},
+		{"trigger count", "trigger 0x100 65536", nil, ErrArgument},
+		{"period range", "period 3600001", nil, ErrArgument},
+	}
+	for _, tt := range tests {
+		tt := tt
+		t.Run(tt.name, func(t *testing.T) {
+			t.Parallel()
+
+			got, err := Encode(tt.s)
+			if !errors.Is(err, tt.wantErr) {
+				t.Fatalf("Encode(%q) error = %v, wantErr %v", tt.s, err, tt.wantErr)
+			}
+			if !bytes.Equal(got, tt.want) {
+				t.Errorf("Encode(%q) = % X, want % X", tt.s, got, tt.want)
+			}
+		})
+	}
+}
+
+func TestWrite(t *testing.T) {
+	t.Parallel()
+
+	name := filepath.Join(t.TempDir(), "control.bin")
+	if err := Write(&name, "enable error 0 0xFE;trigger 0x0105 16"); err != nil {
+		t.Fatalf("Write() error = %v", err)
+	}
+	got, err := os.ReadFile(name)
+	if err != nil {
+		t.Fatal(err)
+	}
+	want := []uint8{1, 1, 0, 0xFE, 0, 0, 0, 0, 5, 16, 0, 0, 0x05, 0x01, 0, 0}
+	if !bytes.Equal(got, want) {
+		t.Errorf("Write() wrote % X, want % X", got, want)
+	}
+
+	if err := Write(&name, "trigger on"); !errors.Is(err, ErrArgument) {
+		t.Errorf("Write() error = %v, want %v", err, ErrArgument)
+	}
+	bad := filepath.Join(t.TempDir(), "missing", "control.bin")
+	if err := Write(&bad, "start"); err == nil {
+		t.Errorf("Write() to %s succeeded", bad)
+	}
+}
@@ -0,0 +1,432 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Package dump decodes the Event Buffer of a target memory image (RAM dump)
+// into the log format written by the Event Recorder with semihosting.
+package dump
+
+import (
+	"bufio"
+	"encoding/binary"
+	"errors"
+	"eventlist/pkg/elf"
+	"fmt"
+	"io"
+	"os"
+)
+
+var ErrInfo = errors.New("EventRecorderInfo not found")
+var ErrProtocol = errors.New("unsupported Event Recorder protocol")
+var ErrAddress = errors.New("address outside of memory image")
+
+// Event Record Information (EventRecord_t.info)
+const (
+	recordIDMask   = 0x0000FFFF
+	recordCtxPos   = 16
+	recordCtxMask  = 0x00070000
+	recordIRQ      = 0x00080000
+	recordSeqPos   = 20
+	recordSeqMask  = 0x00F00000
+	recordFirst    = 0x01000000
+	recordLast     = 0x02000000
+	recordLocked   = 0x04000000
+	recordValid    = 0x08000000
+	recordMsbTs    = 0x10000000
+	recordMsbVal1  = 0x20000000
+	recordMsbVal2  = 0x40000000
+	recordTbit     = 0x80000000
+	recordSize     = 16 // size of EventRecord_t
+	infoSize       = 24 // size of EventRecorderInfo_t (version 1.x)
+	infoPartOffset = 28 // offset of the pointer to EventPartitionInfo_t in EventRecorderInfo_t
+	partInfoSize   = 20 // size of EventPartitionInfo_t
+	statusSize     = 28 // size of EventStatus_t up to ts_last
+	threadSwitchID = 0xFF04
+)
+
+// Event Record Types (Log)
+const (
+	typeData = 1 // EventRecordData
+	typeVal2 = 2 // EventRecord2
+	typeVal4 = 3 // EventRecord4
+)
+
+// Image is a memory image of the target starting at Addr
+type Image struct {
+	Addr uint64
+	Data []uint8
+}
+
+// read size bytes at addr from the memory image
+func (m *Image) read(addr uint64, size uint64) ([]uint8, error) {
+	if addr < m.Addr || addr+size > m.Addr+uint64(len(m.Data)) {
+		return nil, fmt.Errorf("%w: 0x%08X", ErrAddress, addr)
+	}
+	return m.Data[addr-m.Addr : addr-m.Addr+size], nil
+}
+
+// ReadImage reads a memory image file starting at addr
+func ReadImage(filename *string, addr uint64) (*Image, error) {
+	data, err := os.ReadFile(*filename)
+	if err != nil {
+		return nil, err
+	}
+	return &Image{Addr: addr, Data: data}, nil
+}
+
+// Result of decoding an Event Buffer
+type Result struct {
+	Events    int    // number of decoded events
+	Discarded int    // number of records discarded (invalid, overwritten or incomplete)
+	Freq      uint32 // timestamp frequency from EventStatus, 0 if unknown
+}
+
+// one record of the Event Buffer with restored MSBs
+type record struct {
+	ts   uint32
+	val1 uint32
+	val2 uint32
+	info uint32
+}
+
+// record with its position in the merged event order
+type keyed struct {
+	rec record
+	key uint32 // record index of the Event Buffer
+}
+
+// event of a record chain (FIRST record followed by records of the same context)
+type chain struct {
+	rec    record
+	data   []uint8
+	next   uint32 // message number of the next record
+	thread uint8  // thread index at the FIRST record
+}
+
+type decoder struct {
+	out    *bufio.Writer
+	res    Result
+	chains [8]*chain // open chains, index is event context
+	thread uint8     // thread index of last thread switch
+	tsHigh uint64    // timestamp bits [63..32]
+	tsLast uint32    // last timestamp
+	tsInit bool
+}
+
+// get the EventRecorderInfo from the ELF file or the memory image
+func getInfo(img *Image) ([]uint8, error) {
+	addr, _, found := elf.Symbols.GetAddrSize("EventRecorderInfo")
+	if !found {
+		return nil, ErrInfo
+	}
+	if info := elf.Sections.GetData(addr, infoSize); info != nil {
+		return info, nil
+	}
+	return img.read(addr, infoSize)
+}
+
+// get the EventRecorderInfo including the pointer to EventPartitionInfo_t
+// (only when the symbol is large enough), otherwise nil
+func getInfoPartition(img *Image) []uint8 {
+	addr, size, _ := elf.Symbols.GetAddrSize("EventRecorderInfo")
+	if size < infoPartOffset+4 {
+		return nil
+	}
+	if info := elf.Sections.GetData(addr, infoPartOffset+4); info != nil {
+		return info
+	}
+	info, _ := img.read(addr, infoPartOffset+4)
+	return info
+}
+
+// read the valid records of an Event Buffer from the oldest record to the current record index,
+// key returns the position of each record in the merged event order
+func (d *decoder) readRecords(buffer []uint8, count uint32, index uint32, key func(i uint32) uint32) []keyed {
+	var recs []keyed
+	n := count
+	if index < count {
+		n = index
+	}
+	for i := index - n; i != index; i++ {
+		r := buffer[(i&(count-1))*recordSize:]
+		rec := record{
+			ts:   binary.LittleEndian.Uint32(r[0:]),
+			val1: binary.LittleEndian.Uint32(r[4:]),
+			val2: binary.LittleEndian.Uint32(r[8:]),
+			info: binary.LittleEndian.Uint32(r[12:]),
+		}
+		tbit := rec.info & recordTbit
+		// record must be valid, unlocked, written in the current pass (sequence number)
+		// and completely written (toggle bits of the values match the toggle bit of the info)
+		if rec.info&(recordValid|recordLocked) != recordValid ||
+			(rec.info&recordSeqMask)>>recordSeqPos != (i/count)&0xF ||
+			rec.ts&recordTbit != tbit || rec.val1&recordTbit != tbit || rec.val2&recordTbit != tbit {
+			d.res.Discarded++
+			continue
+		}
+		rec.ts = rec.ts&^recordTbit | (rec.info&recordMsbTs)<<3
+		rec.val1 = rec.val1&^recordTbit | (rec.info&recordMsbVal1)<<2
+		rec.val2 = rec.val2&^recordTbit | (rec.info&recordMsbVal2)<<1
+		recs = append(recs, keyed{rec: rec, key: key(i)})
+	}
+	return recs
+}
+
+// read the valid records of the Reserved Partition, the key of each record is the
+// record index of the Event Buffer when it was written
+func (d *decoder) readPartition(img *Image, info []uint8) ([]keyed, error) {
+	addr := binary.LittleEndian.Uint32(info[infoPartOffset:])
+	if addr == 0 { // Reserved Partition disabled
+		return nil, nil
+	}
+	part, err := img.read(uint64(addr), partInfoSize)
+	if err != nil {
+		return nil, err
+	}
+	count := binary.LittleEndian.Uint32(part[0:])
+	if count == 0 || count&(count-1) != 0 {
+		return nil, fmt.Errorf("%w: partition record count %d", ErrProtocol, count)
+	}
+	buffer, err := img.read(uint64(binary.LittleEndian.Uint32(part[4:])), uint64(count)*recordSize)
+	if err != nil {
+		return nil, err
+	}
+	seq, err := img.read(uint64(binary.LittleEndian.Uint32(part[8:])), uint64(count)*4)
+	if err != nil {
+		return nil, err
+	}
+	index, err := img.read(uint64(binary.LittleEndian.Uint32(part[12:])), 4)
+	if err != nil {
+		return nil, err
+	}
+	return d.readRecords(buffer, count, binary.LittleEndian.Uint32(index), func(i uint32) uint32 {
+		return binary.LittleEndian.Uint32(seq[(i&(count-1))*4:])
+	}), nil
+}
+
+// extend the 32-bit timestamp of a record to 64 bits
+func (d *decoder) timestamp(ts uint32) uint64 {
+	if d.tsInit && ts < d.tsLast && d.tsLast-ts > 0x80000000 {
+		d.tsHigh += 1 << 32 // timer overflow
+	}
+	if !d.tsInit || ts > d.tsLast || d.tsLast-ts > 0x80000000 {
+		d.tsLast = ts
+	}
+	d.tsInit = true
+	return d.tsHigh | uint64(ts)
+}
+
+// write an event of thread in the log format: header (type, length), timestamp, info, payload
+func (d *decoder) write(typ uint16, rec *record, thread uint8, length int, payload []uint8) error {
+	if rec.info&recordIRQ != 0 {
+		thread = 0
+	}
+	info := rec.info&recordIDMask | uint32(length)<<16 | uint32(thread&0x3F)<<25
+	if rec.info&recordIRQ != 0 {
+		info |= 0x80000000
+	}
+	buf := make([]uint8, 16, 16+len(payload))
+	binary.LittleEndian.PutUint16(buf[0:], typ)
+	binary.LittleEndian.PutUint16(buf[2:], uint16(12+len(payload)))
+	binary.LittleEndian.PutUint64(buf[4:], d.timestamp(rec.ts))
+	binary.LittleEndian.PutUint32(buf[12:], info)
+	buf = append(buf, payload...)
+	d.res.Events++
+	_, err := d.out.Write(buf)
+	return err
+}
+
+func values(v ...uint32) []uint8 {
+	buf := make([]uint8, 4*len(v))
+	for i := range v {
+		binary.LittleEndian.PutUint32(buf[4*i:], v[i])
+	}
+	return buf
+}
+
+// decode one valid record
+func (d *decoder) add(rec record) error {
+	ctx := (rec.info & recordCtxMask) >> recordCtxPos
+	id := rec.info & recordIDMask
+
+	switch rec.info & (recordFirst | recordLast) {
+	case recordFirst | recordLast: // single record event
+		if id == threadSwitchID {
+			d.thread = uint8(rec.val1)
+		}
+		if ctx != 0 { // EventRecordData with 1..7 bytes
+			return d.write(typeData, &rec, d.thread, int(ctx), values(rec.val1, rec.val2)[:ctx])
+		}
+		return d.write(typeVal2, &rec, d.thread, 0, values(rec.val1, rec.val2))
+	case recordFirst:
+		if d.chains[ctx] != nil { // previous event of this context is incomplete
+			d.res.Discarded++
+		}
+		// the thread switch is recorded before the FIRST record; records of other threads
+		// (with their thread switch) can follow before the chain is complete
+		d.chains[ctx] = &chain{rec: rec, data: values(rec.val1, rec.val2), next: 1, thread: d.thread}
+		return nil
+	}
+
+	c := d.chains[ctx]
+	if rec.info&recordLast == 0 {
+		if id>>8 != 0xFF { // EventRecordData without data
+			return d.write(typeData, &rec, d.thread, 0, nil)
+		}
+		if c == nil || id&0xFF != c.next { // first record of the event is lost
+			d.res.Discarded++
+			return nil
+		}
+		c.data = append(c.data, values(rec.val1, rec.val2)...) // continuation record: 0xFF01 + n
+		c.next++
+		return nil
+	}
+	if c == nil || id&0xFF != c.next {
+		d.res.Discarded++
+		return nil
+	}
+	d.chains[ctx] = nil
+	c.rec.info &^= recordCtxMask
+	length := int(id >> 8)
+	if length == 0 && c.next == 1 { // EventRecord4
+		return d.write(typeVal4, &c.rec, c.thread, 0, append(c.data, values(rec.val1, rec.val2)...))
+	}
+	if length == 0 || length > 8 {
+		d.res.Discarded++
+		return nil
+	}
+	data := append(c.data, values(rec.val1, rec.val2)[:length]...)
+	if len(data) > 0x1FF {
+		d.res.Discarded++
+		return nil
+	}
+	return d.write(typeData, &c.rec, c.thread, len(data), data)
+}
+
+// Decode walks the Event Buffer of the memory image from the oldest record to the
+// current record index and writes the events in the log format to out
+func Decode(img *Image, out io.Writer) (Result, error) {
+	d := decoder{out: bufio.NewWriter(out)}
+
+	info, err := getInfo(img)
+	if err != nil {
+		return d.res, err
+	}
+	if info[0] != 1 || info[3] != 1 { // protocol type DAP, version 1.x
+		return d.res, fmt.Errorf("%w: type %d, version %d.%d", ErrProtocol, info[0], info[3], info[2])
+	}
+	count := binary.LittleEndian.Uint32(info[4:])
+	if count == 0 || count&(count-1) != 0 {
+		return d.res, fmt.Errorf("%w: record count %d", ErrProtocol, count)
+	}
+	status, err := img.read(uint64(binary.LittleEndian.Uint32(info[16:])), statusSize)
+	if err != nil {
+		return d.res, err
+	}
+	buffer, err := img.read(uint64(binary.LittleEndian.Uint32(info[8:])), uint64(count)*recordSize)
+	if err != nil {
+		return d.res, err
+	}
+	index := binary.LittleEndian.Uint32(status[4:])
+	d.res.Freq = binary.LittleEndian.Uint32(status[20:])
+
+	// valid records from the oldest record to the current record index
+	recs := d.readRecords(buffer, count, index, func(i uint32) uint32 { return i })
+
+	// records of the Reserved Partition are merged before the first record
+	// of the Event Buffer that was written after them
+	if part := getInfoPartition(img); part != nil {
+		reserved, err := d.readPartition(img, part)
+		if err != nil {
+			return d.res, err
+		}
+		recs = merge(recs, reserved, index)
+	}
+
+	// timer overflows within the records: the last record belongs to the current overflow counter
+	for i := range recs {
+		d.timestamp(recs[i].rec.ts)
+	}
+	overflows := uint32(d.tsHigh >> 32)
+	d.tsHigh, d.tsLast, d.tsInit = 0, 0, false
+	if overflow := binary.LittleEndian.Uint32(status[16:]); overflow >= overflows {
+		d.tsHigh = uint64(overflow-overflows) << 32
+	}
+
+	for _, r := range recs {
+		if err = d.add(r.rec); err != nil {
+			return d.res, err
+		}
+	}
+	return d.finish()
+}
+
+// merge the records of the Reserved Partition into the records of the Event Buffer
+// by the record index (relative to the current record index to handle wrap around)
+func merge(recs []keyed, reserved []keyed, index uint32) []keyed {
+	if len(reserved) == 0 {
+		return recs
+	}
+	merged := make([]keyed, 0, len(recs)+len(reserved))
+	k := 0
+	for _, r := range recs {
+		for k < len(reserved) && index-reserved[k].key >= index-r.key {
+			merged = append(merged, reserved[k])
+			k++
+		}
+		merged = append(merged, r)
+	}
+	return append(merged, reserved[k:]...)
+}
+
+// count incomplete events and write pending output
+func (d *decoder) finish() (Result, error) {
+	for k, c := range d.chains {
+		if c != nil { // last record not yet written
+			d.res.Discarded++
+			d.chains[k] = nil
+		}
+	}
+	return d.res, d.out.Flush()
+}
+
+// Records converts a stream of event records (for example streamed through ITM)
+// into the log format written by the Event Recorder with semihosting
+type Records struct {
+	d decoder
+}
+
+// NewRecords returns a converter that writes the events in the log format to out
+func NewRecords(out io.Writer) *Records {
+	return &Records{d: decoder{out: bufio.NewWriter(out)}}
+}
+
+// Add decodes one event record with complete 32-bit timestamp and values,
+// info contains the record information without lock, MSB and toggle bits
+func (r *Records) Add(ts, val1, val2, info uint32) error {
+	return r.d.add(record{ts: ts, val1: val1, val2: val2, info: info})
+}
+
+// Discard counts a record that was lost
+func (r *Records) Discard() {
+	r.d.res.Discarded++
+}
+
+// Close counts incomplete events and writes pending output
+func (r *Records) Close() (Result, error) {
+	return r.d.finish()
+}
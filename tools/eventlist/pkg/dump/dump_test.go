@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dump
+
+import (
+	"bufio"
+	"bytes"
+	"encoding/binary"
+	"errors"
+	"eventlist/pkg/elf"
+	"eventlist/pkg/event"
+	"testing"
+)
+
+// test22.dump: RAM image at 0x20000000 with EventRecorderInfo at 0x20000000, EventStatus at 0x20000040
+// and the Event Buffer (64 records) at 0x20000100; 30 iterations of EventRecord2, EventRecord4 and
+// EventRecordData with 3, 20 and 0 bytes (8 records per iteration) with a timer overflow
+var s22 = "../../testdata/test22.dump"
+
+// offset of the info word of record i in test22.dump
+func infoOffset(i int) int {
+	return 0x100 + (i&63)*recordSize + 12
+}
+
+func TestDecode(t *testing.T) { //nolint:golint,paralleltest
+	elf.Symbols.Init("EventRecorderInfo", 0x20000000, infoSize)
+
+	tests := []struct {
+		name      string
+		modify    func(data []uint8)
+		events    int
+		discarded int
+	}{
+		{"complete", func(data []uint8) {}, 40, 0},
+		{"locked", func(data []uint8) { // first record of EventRecord4
+			data[infoOffset(179)+3] |= recordLocked >> 24
+		}, 39, 2},
+		{"toggle bit", func(data []uint8) { // continuation record of EventRecordData
+			data[infoOffset(182)-1] ^= recordTbit >> 24
+		}, 39, 3},
+		{"sequence", func(data []uint8) { // EventRecord2 of previous pass
+			data[infoOffset(186)+2] ^= recordSeqMask >> 16
+		}, 39, 1},
+		{"thread", func(data []uint8) { // EventRecord2 becomes thread switch to thread 22, IRQ flag for EventRecordData
+			binary.LittleEndian.PutUint16(data[infoOffset(178):], threadSwitchID)
+			data[infoOffset(181)+2] |= recordIRQ >> 16
+		}, 40, 0},
+	}
+	for _, tt := range tests { //nolint:golint,paralleltest
+		img, err := ReadImage(&s22, 0x20000000)
+		if err != nil {
+			t.Fatalf("ReadImage() %s error = %v", tt.name, err)
+		}
+		tt.modify(img.Data)
+		var buf bytes.Buffer
+		res, err := Decode(img, &buf)
+		if err != nil {
+			t.Fatalf("Decode() %s error = %v", tt.name, err)
+		}
+		if res.Events != tt.events || res.Discarded != tt.discarded || res.Freq != 1000000 {
+			t.Errorf("Decode() %s = %v, want %d events, %d discarded", tt.name, res, tt.events, tt.discarded)
+		}
+		in := bufio.NewReader(&buf)
+		var evs []event.Data
+		for {
+			var ev event.Data
+			if ev.Read(in) != nil {
+				break
+			}
+			evs = append(evs, ev)
+		}
+		if len(evs) != tt.events {
+			t.Fatalf("Decode() %s read %d events, want %d", tt.name, len(evs), tt.events)
+		}
+		if tt.name == "thread" {
+			if evs[1].Info.Thread != 22 || evs[2].Info.Thread != 0 || !evs[2].Info.IsIRQ() || evs[3].Info.Thread != 22 {
+				t.Errorf("Decode() %s threads = %v", tt.name, evs[:4])
+			}
+		}
+		if tt.name != "complete" {
+			continue
+		}
+		// first event: EventRecord2 of iteration 22 recorded after the timer overflow
+		if ev := evs[0]; ev.Info.ID != 0x0A00 || ev.Typ != 2 || ev.Value1 != 22 || uint32(ev.Value2) != 0x80000016 ||
+			ev.Time != 0x100000000+535 {
+			t.Errorf("Decode() %s event 0 = %v", tt.name, ev)
+		}
+		if ev := evs[1]; ev.Info.ID != 0x0A01 || ev.Typ != 3 || uint32(ev.Value2) != 0xC0000000 || uint32(ev.Value4) != 0x80000004 {
+			t.Errorf("Decode() %s event 1 = %v", tt.name, ev)
+		}
+		if ev := evs[2]; ev.Info.ID != 0x0A02 || ev.Typ != 1 || string(*ev.Data) != "abc" {
+			t.Errorf("Decode() %s event 2 = %v", tt.name, ev)
+		}
+		if ev := evs[3]; ev.Info.ID != 0x0A03 || ev.Typ != 1 || string(*ev.Data) != "0123456789abcdefghij" {
+			t.Errorf("Decode() %s event 3 = %v", tt.name, ev)
+		}
+		if ev := evs[4]; ev.Info.ID != 0x0A04 || ev.Typ != 1 || len(*ev.Data) != 0 {
+			t.Errorf("Decode() %s event 4 = %v", tt.name, ev)
+		}
+	}
+}
+
+func TestDecode_threadInterleave(t *testing.T) { //nolint:golint,paralleltest
+	// Thread 5 records EventRecord4 and EventRecordData (20 bytes) with thread switch before the FIRST record;
+	// thread 7 preempts thread 5 after the FIRST records and records an event, an interrupt records before thread 5
+	// completes its events (without another thread switch)
+	recs := []record{
+		{ts: 10, val1: 5, info: threadSwitchID | recordFirst | recordLast},
+		{ts: 11, val1: 1, val2: 2, info: 0x0A01 | 1<<recordCtxPos | recordFirst},
+		{ts: 12, val1: 0x64636261, val2: 0x68676665, info: 0x0A03 | 2<<recordCtxPos | recordFirst},
+		{ts: 13, val1: 7, info: threadSwitchID | recordFirst | recordLast},
+		{ts: 14, val1: 8, val2: 9, info: 0x0A00 | recordFirst | recordLast},
+		{ts: 15, info: 0x0A04 | recordIRQ},
+		{ts: 17, val1: 3, val2: 4, info: 0x0001 | 1<<recordCtxPos | recordLast},
+		{ts: 18, val1: 0x6C6B6A69, val2: 0x706F6E6D, info: 0xFF01 | 2<<recordCtxPos},
+		{ts: 19, val1: 0x74737271, info: 0x0402 | 2<<recordCtxPos | recordLast},
+	}
+	var buf bytes.Buffer
+	d := decoder{out: bufio.NewWriter(&buf)}
+	for _, rec := range recs {
+		rec.info |= recordValid
+		if err := d.add(rec); err != nil {
+			t.Fatalf("decoder.add() error = %v", err)
+		}
+	}
+	if err := d.out.Flush(); err != nil {
+		t.Fatal(err)
+	}
+	in := bufio.NewReader(&buf)
+	var evs []event.Data
+	for {
+		var ev event.Data
+		if ev.Read(in) != nil {
+			break
+		}
+		evs = append(evs, ev)
+	}
+	want := []struct {
+		id     uint16
+		thread uint8
+	}{
+		{threadSwitchID, 5}, {threadSwitchID, 7}, {0x0A00, 7}, {0x0A04, 0}, {0x0A01, 5}, {0x0A03, 5},
+	}
+	if len(evs) != len(want) || d.res.Discarded != 0 {
+		t.Fatalf("decoder.add() %d events, %d discarded, want %d events", len(evs), d.res.Discarded, len(want))
+	}
+	for i, w := range want {
+		if evs[i].Info.ID != w.id || evs[i].Info.Thread != w.thread {
+			t.Errorf("decoder.add() event %d = %v, want ID 0x%04X thread %d", i, evs[i], w.id, w.thread)
+		}
+	}
+	if evs[5].Typ != 1 || string(*evs[5].Data) != "abcdefghijklmnopqrst" {
+		t.Errorf("decoder.add() event 5 = %v", evs[5])
+	}
+}
+
+// test25.dump: RAM image (layout of test22.dump) recorded by EventRecorder.c with EVENT_COALESCE: EventRecord2
+// 0x0A01 three times, 0x0B07 twice, stdout "hi\n", 0x0A01 twice, EventRecorderStop and EventRecorderStart
+var s25 = "../../testdata/test25.dump"
+
+func TestDecode_repeat(t *testing.T) { //nolint:golint,paralleltest
+	elf.Symbols.Init("EventRecorderInfo", 0x20000000, infoSize)
+
+	img, err := ReadImage(&s25, 0x20000000)
+	if err != nil {
+		t.Fatalf("ReadImage() error = %v", err)
+	}
+	var buf bytes.Buffer
+	res, err := Decode(img, &buf)
+	if err != nil || res.Discarded != 0 {
+		t.Fatalf("Decode() = %v, %v", res, err)
+	}
+	in := bufio.NewReader(&buf)
+	var evs []event.Data
+	for {
+		var ev event.Data
+		if ev.Read(in) != nil {
+			break
+		}
+		evs = append(evs, ev)
+	}
+	// Repeat event (0xFF15): val1 = number of repeats, val2 = ID of the repeated event, recorded before
+	// the event that ends the sequence with the timestamp of the last repeat
+	want := []struct {
+		id     uint16
+		time   uint64
+		v1, v2 int32
+	}{
+		{0xFF00, 100, 1, 1000000}, {0xFF01, 100, 0, 0},
+		{0x0A01, 110, 1, 2}, {0xFF15, 130, 2, 0x0A01},
+		{0x0B07, 140, 3, 4}, {0xFF15, 150, 1, 0x0B07},
+		{0xFE00, 160, 0, 0},
+		{0x0A01, 170, 1, 2}, {0xFF15, 180, 1, 0x0A01},
+		{0xFF02, 190, 0, 0}, {0xFF01, 200, 0, 0},
+	}
+	if len(evs) != len(want) {
+		t.Fatalf("Decode() %d events, want %d", len(evs), len(want))
+	}
+	for i, w := range want {
+		if ev := evs[i]; ev.Info.ID != w.id || ev.Time != w.time || ev.Value1 != w.v1 || ev.Value2 != w.v2 {
+			t.Errorf("Decode() event %d = %v, want ID 0x%04X time %d values %d, 0x%X", i, ev, w.id, w.time, w.v1, w.v2)
+		}
+	}
+}
+
+func TestDecode_err(t *testing.T) { //nolint:golint,paralleltest
+	img, err := ReadImage(&s22, 0x20000000)
+	if err != nil {
+		t.Fatalf("ReadImage() error = %v", err)
+	}
+	var buf bytes.Buffer
+
+	elf.Symbols.Init("main", 0x20000000, 4)
+	if _, err = Decode(img, &buf); !errors.Is(err, ErrInfo) {
+		t.Errorf("Decode() without symbol error = %v, want %v", err, ErrInfo)
+	}
+	elf.Symbols.Init("EventRecorderInfo", 0x1FFFFFF0, infoSize)
+	if _, err = Decode(img, &buf); !errors.Is(err, ErrAddress) {
+		t.Errorf("Decode() outside of image error = %v, want %v", err, ErrAddress)
+	}
+	elf.Symbols.Init("EventRecorderInfo", 0x20000000, infoSize)
+	binary.LittleEndian.PutUint32(img.Data[4:], 48)
+	if _, err = Decode(img, &buf); !errors.Is(err, ErrProtocol) {
+		t.Errorf("Decode() record count error = %v, want %v", err, ErrProtocol)
+	}
+	img.Data[3] = 2
+	if _, err = Decode(img, &buf); !errors.Is(err, ErrProtocol) {
+		t.Errorf("Decode() protocol version error = %v, want %v", err, ErrProtocol)
+	}
+}
+
+func TestDecode_partition(t *testing.T) { //nolint:golint,paralleltest
+	img, err := ReadImage(&s22, 0x20000000)
+	if err != nil {
+		t.Fatalf("ReadImage() error = %v", err)
+	}
+	// Reserved Partition (8 records) appended to the image: EventPartitionInfo_t, records, sequence numbers, index
+	base := uint32(0x20000000 + len(img.Data))
+	part := make([]uint8, partInfoSize+8*recordSize+8*4+4)
+	binary.LittleEndian.PutUint32(part[0:], 8)
+	binary.LittleEndian.PutUint32(part[4:], base+partInfoSize)
+	binary.LittleEndian.PutUint32(part[8:], base+partInfoSize+8*recordSize)
+	binary.LittleEndian.PutUint32(part[12:], base+partInfoSize+8*recordSize+8*4)
+	binary.LittleEndian.PutUint32(part[partInfoSize+8*recordSize+8*4:], 2)
+	ts := binary.LittleEndian.Uint32(img.Data[infoOffset(185)-12:]) &^ recordTbit
+	for i, r := range []struct {
+		id  uint32
+		key uint32
+	}{{0x0B00, 186}, {0x0B01, 202}} {
+		rec := part[partInfoSize+i*recordSize:]
+		binary.LittleEndian.PutUint32(rec[0:], ts+uint32(i))
+		binary.LittleEndian.PutUint32(rec[4:], 0x100+uint32(i))
+		binary.LittleEndian.PutUint32(rec[8:], 0x200+uint32(i))
+		binary.LittleEndian.PutUint32(rec[12:], r.id|recordFirst|recordLast|recordValid)
+		binary.LittleEndian.PutUint32(part[partInfoSize+8*recordSize+i*4:], r.key)
+	}
+	img.Data = append(img.Data, part...)
+	binary.LittleEndian.PutUint32(img.Data[infoPartOffset:], base)
+
+	elf.Symbols.Init("EventRecorderInfo", 0x20000000, infoSize)
+	var buf bytes.Buffer
+	if res, err := Decode(img, &buf); err != nil || res.Events != 40 {
+		t.Errorf("Decode() without partition pointer = %v, %v, want 40 events", res, err)
+	}
+
+	elf.Symbols.Init("EventRecorderInfo", 0x20000000, infoPartOffset+4)
+	part[partInfoSize+recordSize+7] |= recordTbit >> 24 // second record incomplete
+	copy(img.Data[base-0x20000000:], part)
+	buf.Reset()
+	res, err := Decode(img, &buf)
+	if err != nil || res.Events != 41 || res.Discarded != 1 {
+		t.Fatalf("Decode() = %v, %v, want 41 events, 1 discarded", res, err)
+	}
+	in := bufio.NewReader(&buf)
+	var evs []event.Data
+	for {
+		var ev event.Data
+		if ev.Read(in) != nil {
+			break
+		}
+		evs = append(evs, ev)
+	}
+	// reserved event is merged after iteration 22 (records 178..185)
+	if ev := evs[5]; ev.Info.ID != 0x0B00 || ev.Typ != 2 || ev.Value1 != 0x100 || ev.Value2 != 0x200 ||
+		ev.Time != evs[4].Time {
+		t.Errorf("Decode() reserved event = %v", ev)
+	}
+	if evs[4].Info.ID != 0x0A04 || evs[6].Info.ID != 0x0A00 {
+		t.Errorf("Decode() events around reserved event = %v, %v", evs[4], evs[6])
+	}
+
+	binary.LittleEndian.PutUint32(img.Data[base-0x20000000:], 12)
+	if _, err = Decode(img, &buf); !errors.Is(err, ErrProtocol) {
+		t.Errorf("Decode() partition record count error = %v, want %v", err, ErrProtocol)
+	}
+}
@@ -88,6 +88,16 @@ func (s *sections) GetString(addr uint64) string {
 	return ""
 }
 
+// get size bytes at addr, nil if not completely within a section
+func (s *sections) GetData(addr uint64, size uint64) []uint8 {
+	for _, es := range s.sections {
+		if addr >= es.addr && addr+size <= es.addr+uint64(len(es.data)) {
+			return es.data[addr-es.addr : addr-es.addr+size]
+		}
+	}
+	return nil
+}
+
 func (s *symbols) Init(name string, addr uint64, size uint64) {
 	s.symbols = make(map[string]symbol)
 	s.symbols[name] = symbol{addr, size}
@@ -98,6 +98,30 @@ func TestGetString(t *testing.T) {
 	}
 }
 
+func TestGetData(t *testing.T) {
+	t.Parallel()
+
+	s := &sections{}
+	s.sections = append(s.sections, &elfSection{"", 100, []uint8{0, 1, 2, 3, 4, 5, 6, 7}})
+
+	tests := []struct {
+		name string
+		addr uint64
+		size uint64
+		want []uint8
+	}{
+		{"test_1", 100, 4, []uint8{0, 1, 2, 3}},
+		{"test_2", 104, 4, []uint8{4, 5, 6, 7}},
+		{"test_err1", 99, 4, nil},
+		{"test_err2", 105, 4, nil},
+	}
+	for _, tt := range tests {
+		if got := s.GetData(tt.addr, tt.size); !reflect.DeepEqual(got, tt.want) {
+			t.Errorf("GetData() %s = %v, want %v", tt.name, got, tt.want)
+		}
+	}
+}
+
 func Test_symbols_Init(t *testing.T) {
 	t.Parallel()
 
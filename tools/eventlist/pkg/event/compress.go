@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package event
+
+import (
+	"errors"
+	"eventlist/pkg/eval"
+)
+
+var errCompressed = errors.New("invalid compressed event data")
+
+// decompress event data compressed by EventCompress in EventRecorder.c
+// token 0x00..0x7F: n+1 literal bytes follow
+// token 0x80..0xFF: next byte is length-3, repeat from distance (token & 0x7F) + 1
+func decompress(in []byte, length int) ([]byte, error) {
+	out := make([]byte, 0, length)
+	for i := 0; i < len(in); {
+		t := in[i]
+		i++
+		if t < 0x80 {
+			n := int(t) + 1
+			if i+n > len(in) {
+				return nil, errCompressed
+			}
+			out = append(out, in[i:i+n]...)
+			i += n
+		} else {
+			if i >= len(in) {
+				return nil, errCompressed
+			}
+			d := int(t&0x7F) + 1
+			n := int(in[i]) + 3
+			i++
+			if d > len(out) {
+				return nil, errCompressed
+			}
+			for ; n > 0; n-- {
+				out = append(out, out[len(out)-d])
+			}
+		}
+		if len(out) > length {
+			return nil, errCompressed
+		}
+	}
+	if len(out) != length {
+		return nil, errCompressed
+	}
+	return out, nil
+}
+
+// replace the compressed data of a record by the decompressed data
+func decompressData(typ uint16, data []byte) ([]byte, error) {
+	var head int
+	switch typ {
+	case 1: // EventrecordData
+		head = 12
+	case 4: // EventRecordFragment
+		head = 20
+	default:
+		return nil, errCompressed
+	}
+	if len(data) < head {
+		return nil, eval.ErrEof
+	}
+	var info Info
+	info.getInfoFromBytes(data[8:12])
+	length := int(info.length) - (head - 12)
+	if length < 0 {
+		return nil, errCompressed
+	}
+	out, err := decompress(data[head:], length)
+	if err != nil {
+		return nil, err
+	}
+	return append(data[:head:head], out...), nil
+}
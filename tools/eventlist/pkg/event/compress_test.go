@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package event
+
+import (
+	"reflect"
+	"testing"
+)
+
+func Test_decompress(t *testing.T) {
+	t.Parallel()
+
+	type args struct {
+		in     []byte
+		length int
+	}
+	tests := []struct {
+		name    string
+		args    args
+		want    []byte
+		wantErr bool
+	}{
+		{"literal", args{[]byte{0x02, 'a', 'b', 'c'}, 3}, []byte("abc"), false},
+		{"run", args{[]byte{0x00, 0x00, 0x80, 0x04}, 8}, make([]byte, 8), false},
+		{"pattern", args{[]byte{0x02, 'a', 'b', 'c', 0x82, 0x03, 0x00, 'x'}, 10}, []byte("abcabcabcx"), false},
+		{"empty", args{[]byte{}, 0}, []byte{}, false},
+		{"short literal", args{[]byte{0x03, 'a', 'b', 'c'}, 4}, nil, true},
+		{"short match", args{[]byte{0x00, 'a', 0x80}, 4}, nil, true},
+		{"distance", args{[]byte{0x00, 'a', 0x81, 0x00}, 4}, nil, true},
+		{"too long", args{[]byte{0x00, 'a', 0x80, 0x04}, 4}, nil, true},
+		{"too short", args{[]byte{0x00, 'a', 0x80, 0x00}, 5}, nil, true},
+	}
+	for _, tt := range tests {
+		tt := tt
+		t.Run(tt.name, func(t *testing.T) {
+			t.Parallel()
+
+			got, err := decompress(tt.args.in, tt.args.length)
+			if (err != nil) != tt.wantErr {
+				t.Errorf("decompress() %s error = %v, wantErr %v", tt.name, err, tt.wantErr)
+				return
+			}
+			if !reflect.DeepEqual(got, tt.want) {
+				t.Errorf("decompress() %s = %v, want %v", tt.name, got, tt.want)
+			}
+		})
+	}
+}
+
+func Test_decompressData(t *testing.T) {
+	t.Parallel()
+
+	head1 := []byte{1, 0, 0, 0, 0, 0, 0, 0, 0x00, 0x10, 0x04, 0x00}
+	head4 := []byte{1, 0, 0, 0, 0, 0, 0, 0, 0x00, 0x10, 0x0C, 0x00, 1, 0, 4, 0, 0, 0, 0, 0}
+	data := []byte{0x00, 'z', 0x80, 0x00}
+
+	type args struct {
+		typ  uint16
+		data []byte
+	}
+	tests := []struct {
+		name    string
+		args    args
+		want    []byte
+		wantErr bool
+	}{
+		{"data", args{1, append(append([]byte{}, head1...), data...)}, append(append([]byte{}, head1...), "zzzz"...), false},
+		{"fragment", args{4, append(append([]byte{}, head4...), data...)}, append(append([]byte{}, head4...), "zzzz"...), false},
+		{"type", args{2, append(append([]byte{}, head1...), data...)}, nil, true},
+		{"short", args{4, head1}, nil, true},
+		{"invalid", args{1, append(append([]byte{}, head1...), 0x80)}, nil, true},
+	}
+	for _, tt := range tests {
+		tt := tt
+		t.Run(tt.name, func(t *testing.T) {
+			t.Parallel()
+
+			got, err := decompressData(tt.args.typ, tt.args.data)
+			if (err != nil) != tt.wantErr {
+				t.Errorf("decompressData() %s error = %v, wantErr %v", tt.name, err, tt.wantErr)
+				return
+			}
+			if !reflect.DeepEqual(got, tt.want) {
+				t.Errorf("decompressData() %s = %v, want %v", tt.name, got, tt.want)
+			}
+		})
+	}
+}
@@ -87,14 +87,22 @@ type Info struct {
 	ID     uint16
 	length uint16
 	irq    bool
+	Thread uint8 // thread index, 0 = IRQ or unknown thread
 }
 
-// get the info fields from byte stream
+// get the info fields from byte stream:
+// [15..0] ID, [24..16] length, [30..25] thread index, [31] IRQ flag
 func (info *Info) getInfoFromBytes(data []byte) {
 	info.ID = convert16(data[0:2])
 	info.length = convert16(data[2:4])
 	info.irq = (info.length & 0x8000) != 0
-	info.length &= 0x7FFF
+	info.Thread = uint8(info.length >> 9 & 0x3F)
+	info.length &= 0x01FF
+}
+
+// IsIRQ returns true if the event was recorded by an interrupt
+func (info *Info) IsIRQ() bool {
+	return info.irq
 }
 
 func (info *Info) SplitID() (class uint16, group uint16, idx uint16, start bool) {
@@ -288,10 +296,24 @@ func (e *Data) GetValuesAsString() string {
 	case 3: // Eventrecord4
 		value = fmt.Sprintf("val1=0x%08x, val2=0x%08x, val3=0x%08x, val4=0x%08x",
 			uint32(e.Value1), uint32(e.Value2), uint32(e.Value3), uint32(e.Value4))
+	case 4: // EventRecordFragment
+		xfer, total, offset := e.GetFragment()
+		value = fmt.Sprintf("xfer=%d, offset=%d, total=%d, data=0x", xfer, offset, total)
+		for _, d := range *e.Data {
+			value += fmt.Sprintf("%02x", d)
+		}
 	}
 	return value
 }
 
+// get transfer ID, total length and offset of a fragment
+func (e *Data) GetFragment() (xfer uint16, total int, offset int) {
+	xfer = uint16(uint32(e.Value1))
+	total = int(uint32(e.Value1) >> 16)
+	offset = int(uint32(e.Value2))
+	return
+}
+
 type Binary struct {
 	file *os.File
 }
@@ -341,6 +363,12 @@ func (e *Data) Read(in *bufio.Reader) error {
 	if len(data) < 12 {
 		return eval.ErrEof
 	}
+	if typ&0x8000 != 0 { // compressed event data
+		if data, err = decompressData(typ&0x7FFF, data); err != nil {
+			return err
+		}
+		typ &= 0x7FFF
+	}
 	e.Time = convert64(data[:8])
 	e.Info.getInfoFromBytes(data[8:12])
 	e.Typ = typ
@@ -365,6 +393,14 @@ func (e *Data) Read(in *bufio.Reader) error {
 		e.Value2 = int32(convert32(data[16:20]))
 		e.Value3 = int32(convert32(data[20:24]))
 		e.Value4 = int32(convert32(data[24:28]))
+	case 4: // EventRecordFragment
+		if e.Info.length < 8 || len(data) < 12+int(e.Info.length) {
+			return eval.ErrEof
+		}
+		e.Value1 = int32(convert32(data[12:16])) // transfer ID and total length
+		e.Value2 = int32(convert32(data[16:20])) // offset
+		e.Data = new([]uint8)
+		*e.Data = data[20 : 12+int(e.Info.length)]
 	}
 	return nil
 }
@@ -96,7 +96,7 @@ func TestInfo_getInfoFromBytes(t *testing.T) {
 		args   args
 		want   Info
 	}{
-		{"normal", fields{}, args{[]byte{0x34, 0x12, 0x78, 0xd6}}, Info{0x1234, 0x5678, true}},
+		{"normal", fields{}, args{[]byte{0x34, 0x12, 0x78, 0xd6}}, Info{0x1234, 0x0078, true, 0x2B}},
 	}
 	for _, tt := range tests {
 		tt := tt
@@ -413,6 +413,7 @@ func TestData_GetValuesAsString(t *testing.T) {
 		{"GetValuesAsString 1", fields{Typ: 1, Data: &[]uint8{1, 2, 0x80}}, "data=0x010280"},
 		{"GetValuesAsString 2", fields{Typ: 2, Value1: -0x8000, Value2: 0x12345678}, "val1=0xffff8000, val2=0x12345678"},
 		{"GetValuesAsString 3", fields{Typ: 3, Value1: -0x8000, Value2: 0x12345678, Value3: 0xABCDEF, Value4: 0x76543210}, "val1=0xffff8000, val2=0x12345678, val3=0x00abcdef, val4=0x76543210"},
+		{"GetValuesAsString 4", fields{Typ: 4, Data: &[]uint8{1, 2, 0x80}, Value1: 0x00100007, Value2: 4}, "xfer=7, offset=4, total=16, data=0x010280"},
 	}
 	for _, tt := range tests {
 		tt := tt
@@ -528,8 +529,12 @@ func TestEventData_Read(t *testing.T) {
 	var s9 = "../../testdata/test9.binary"
 	var s12 = "../../testdata/test12.binary"
 	var s13 = "../../testdata/test13.binary"
+	var s14 = "../../testdata/test14.binary"
+	var s16 = "../../testdata/test16.binary"
 
 	var b0 = []uint8("hello wo")
+	var b1 = []uint8("wxyz")
+	var b2 = []uint8("aaaaaaaaaa")
 
 	type fields struct {
 		Time   uint64
@@ -558,13 +563,15 @@ func TestEventData_Read(t *testing.T) {
 		{"read fail1", fields{}, args{}, &s1, false, Data{}, false, true},
 		{"read fail2", fields{}, args{}, &s2, false, Data{}, false, true},
 		{"read fail3", fields{}, args{}, &s8, false, Data{}, true, false},
-		{"read fail4", fields{}, args{}, &s9, false, Data{Typ: 1, Time: 1410, Info: Info{0xfe00, 8, false}}, true, false},
-		{"read fail5", fields{}, args{}, &s12, false, Data{Typ: 2, Time: 31, Info: Info{0xff00, 0, false}}, true, false},
-		{"read fail6", fields{}, args{}, &s13, false, Data{Typ: 3, Time: 306, Info: Info{0xf000, 0, true}}, true, false},
+		{"read fail4", fields{}, args{}, &s9, false, Data{Typ: 1, Time: 1410, Info: Info{0xfe00, 8, false, 0}}, true, false},
+		{"read fail5", fields{}, args{}, &s12, false, Data{Typ: 2, Time: 31, Info: Info{0xff00, 0, false, 0}}, true, false},
+		{"read fail6", fields{}, args{}, &s13, false, Data{Typ: 3, Time: 306, Info: Info{0xf000, 0, true, 0}}, true, false},
 		{"read failOpen", fields{}, args{}, &sNix, true, Data{}, true, false},
-		{"read ok1", fields{}, args{}, &s3, false, Data{Typ: 1, Data: &b0, Time: 1410, Info: Info{0xfe00, 8, false}}, false, false},
-		{"read ok2", fields{}, args{}, &s4, false, Data{Typ: 2, Value1: 1, Value2: 2, Time: 31, Info: Info{0xff00, 0, false}}, false, false},
-		{"read ok3", fields{}, args{}, &s5, false, Data{Typ: 3, Value1: 805332648, Value2: 24000, Value3: 1, Value4: -65536, Time: 306, Info: Info{0xf000, 0, true}}, false, false},
+		{"read ok1", fields{}, args{}, &s3, false, Data{Typ: 1, Data: &b0, Time: 1410, Info: Info{0xfe00, 8, false, 0}}, false, false},
+		{"read ok2", fields{}, args{}, &s4, false, Data{Typ: 2, Value1: 1, Value2: 2, Time: 31, Info: Info{0xff00, 0, false, 0}}, false, false},
+		{"read ok3", fields{}, args{}, &s5, false, Data{Typ: 3, Value1: 805332648, Value2: 24000, Value3: 1, Value4: -65536, Time: 306, Info: Info{0xf000, 0, true, 0}}, false, false},
+		{"read ok5", fields{}, args{}, &s16, false, Data{Typ: 1, Data: &b2, Time: 77, Info: Info{0x1000, 10, false, 0}}, false, false},
+		{"read ok4", fields{}, args{}, &s14, false, Data{Typ: 4, Data: &b1, Value1: 0x000a0007, Value2: 4, Time: 500, Info: Info{0x1001, 12, false, 0}}, false, false},
 	}
 	for _, tt := range tests {
 		tt := tt
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package event
+
+type transferKey struct {
+	id   uint16
+	xfer uint16
+}
+
+type transfer struct {
+	ev       Data
+	filled   []bool
+	received int
+}
+
+type Transfer struct {
+	Event    Data
+	Received int
+}
+
+// reassembles events recorded as fragments by EventRecordFragment
+type Fragments struct {
+	transfers map[transferKey]*transfer
+	order     []*transfer
+}
+
+// add a fragment, returns true if the transfer is complete
+// ev is then replaced by the reassembled event
+func (f *Fragments) Add(ev *Data) bool {
+	if ev.Typ != 4 || ev.Data == nil {
+		return false
+	}
+	xfer, total, offset := ev.GetFragment()
+	frag := *ev.Data
+	if offset+len(frag) > total {
+		return false // invalid fragment
+	}
+	if f.transfers == nil {
+		f.transfers = make(map[transferKey]*transfer)
+	}
+	key := transferKey{ev.Info.ID, xfer}
+	t := f.transfers[key]
+	if t != nil && (len(*t.ev.Data) != total || (len(frag) > 0 && t.filled[offset])) {
+		t = nil // transfer ID reused, keep previous transfer as incomplete
+	}
+	if t == nil {
+		t = new(transfer)
+		t.ev = Data{Time: ev.Time, Typ: 1, Info: ev.Info}
+		t.ev.Info.length = uint16(total)
+		t.ev.Data = new([]uint8)
+		*t.ev.Data = make([]uint8, total)
+		t.filled = make([]bool, total)
+		f.transfers[key] = t
+		f.order = append(f.order, t)
+	}
+	for i, d := range frag {
+		if !t.filled[offset+i] {
+			t.filled[offset+i] = true
+			t.received++
+		}
+		(*t.ev.Data)[offset+i] = d
+	}
+	if t.received != total {
+		return false
+	}
+	delete(f.transfers, key)
+	for i := range f.order {
+		if f.order[i] == t {
+			f.order = append(f.order[:i], f.order[i+1:]...)
+			break
+		}
+	}
+	*ev = t.ev
+	return true
+}
+
+// get all transfers that were not completed in order of appearance
+func (f *Fragments) Incomplete() []Transfer {
+	transfers := make([]Transfer, 0, len(f.order))
+	for _, t := range f.order {
+		transfers = append(transfers, Transfer{t.ev, t.received})
+	}
+	return transfers
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package event
+
+import (
+	"reflect"
+	"testing"
+)
+
+func fragment(time uint64, id uint16, xfer uint16, total int, offset int, data string) Data {
+	d := []uint8(data)
+	return Data{Time: time, Typ: 4, Info: Info{ID: id, length: uint16(8 + len(d))},
+		Value1: int32(uint32(xfer) | uint32(total)<<16), Value2: int32(offset), Data: &d}
+}
+
+func TestFragments_Add(t *testing.T) {
+	t.Parallel()
+
+	var hello = []uint8("hello world")
+
+	tests := []struct {
+		name       string
+		frags      []Data
+		want       []bool
+		wantEvent  Data
+		incomplete []int
+	}{
+		{"in order", []Data{
+			fragment(10, 0x1001, 1, 11, 0, "hello"),
+			fragment(20, 0x1001, 1, 11, 5, " world"),
+		}, []bool{false, true}, Data{Time: 10, Typ: 1, Info: Info{0x1001, 11, false, 0}, Data: &hello}, nil},
+		{"out of order", []Data{
+			fragment(10, 0x1001, 1, 11, 5, " world"),
+			fragment(20, 0x1001, 1, 11, 0, "hello"),
+		}, []bool{false, true}, Data{Time: 10, Typ: 1, Info: Info{0x1001, 11, false, 0}, Data: &hello}, nil},
+		{"interleaved", []Data{
+			fragment(10, 0x1001, 1, 11, 0, "hello"),
+			fragment(15, 0x1001, 2, 4, 0, "ab"),
+			fragment(20, 0x1001, 1, 11, 5, " world"),
+		}, []bool{false, false, true}, Data{Time: 10, Typ: 1, Info: Info{0x1001, 11, false, 0}, Data: &hello}, []int{2}},
+		{"reused", []Data{
+			fragment(10, 0x1001, 1, 11, 0, "hello"),
+			fragment(20, 0x1001, 1, 11, 0, "hello"),
+			fragment(30, 0x1001, 1, 11, 5, " world"),
+		}, []bool{false, false, true}, Data{Time: 20, Typ: 1, Info: Info{0x1001, 11, false, 0}, Data: &hello}, []int{5}},
+		{"invalid", []Data{
+			fragment(10, 0x1001, 1, 4, 2, "hello"),
+			{Typ: 2},
+		}, []bool{false, false}, Data{Typ: 2}, nil},
+	}
+	for _, tt := range tests {
+		tt := tt
+		t.Run(tt.name, func(t *testing.T) {
+			t.Parallel()
+
+			var f Fragments
+			var ev Data
+			for i := range tt.frags {
+				ev = tt.frags[i]
+				if got := f.Add(&ev); got != tt.want[i] {
+					t.Errorf("Fragments.Add() %s [%d] = %v, want %v", tt.name, i, got, tt.want[i])
+				}
+			}
+			if !reflect.DeepEqual(ev, tt.wantEvent) {
+				t.Errorf("Fragments.Add() %s = %v, want %v", tt.name, ev, tt.wantEvent)
+			}
+			incomplete := f.Incomplete()
+			if len(incomplete) != len(tt.incomplete) {
+				t.Errorf("Fragments.Incomplete() %s = %v, want %v", tt.name, incomplete, tt.incomplete)
+				return
+			}
+			for i, tr := range incomplete {
+				if tr.Received != tt.incomplete[i] {
+					t.Errorf("Fragments.Incomplete() %s [%d] = %d, want %d", tt.name, i, tr.Received, tt.incomplete[i])
+				}
+			}
+		})
+	}
+}
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package output
+
+import (
+	"bufio"
+	"fmt"
+	"sort"
+	"strings"
+)
+
+// events of IRQ Tracing (component 0xFF)
+const (
+	idIrqEntry = 0xFF06 // entry of traced exception, val1 = exception number
+	idIrqExit  = 0xFF07 // exit of traced exception, val1 = exception number
+	idIrqTrace = 0xFF08 // tracing of exception enabled
+	idIrqTable = 0xFF09 // vector table relocated
+)
+
+// names of the system exceptions
+var exceptionNames = map[uint32]string{
+	2:  "NMI",
+	3:  "HardFault",
+	4:  "MemManage",
+	5:  "BusFault",
+	6:  "UsageFault",
+	7:  "SecureFault",
+	11: "SVCall",
+	12: "DebugMon",
+	14: "PendSV",
+	15: "SysTick",
+}
+
+// get the name of an exception: system exception name or IRQ(n) with the interrupt number
+func exceptionName(n uint32) string {
+	if n >= 16 {
+		return fmt.Sprintf("IRQ(%d)", n-16)
+	}
+	if name, ok := exceptionNames[n]; ok {
+		return name
+	}
+	return fmt.Sprintf("Exc(%d)", n)
+}
+
+// statistic of a traced exception
+type irqStatistic struct {
+	count   int
+	tot     float64 // execution time without nested exceptions
+	max     float64 // worst-case latency: entry to exit including nested exceptions
+	maxTime float64 // time of entry with worst-case latency
+	nesting int     // maximum nesting depth (1 = not nested)
+}
+
+// active exception
+type irqActive struct {
+	n      uint32
+	start  float64
+	nested float64 // execution time of nested exceptions
+}
+
+type irqTrace struct {
+	irqs      map[uint32]*irqStatistic // key is exception number
+	active    []irqActive              // stack of active exceptions
+	first     float64                  // time of first event
+	last      float64                  // time of last event
+	overhead  float64                  // time of one event record (measured on relocation of the vector table)
+	tableTime float64                  // time of vector table relocation
+	table     bool                     // true if last event is the vector table relocation
+}
+
+func (it *irqTrace) init() {
+	it.irqs = make(map[uint32]*irqStatistic)
+	it.active = nil
+	it.first = 0
+	it.last = 0
+	it.overhead = 0
+	it.table = false
+}
+
+func (it *irqTrace) get(n uint32) *irqStatistic {
+	is, ok := it.irqs[n]
+	if !ok {
+		is = new(irqStatistic)
+		it.irqs[n] = is
+	}
+	return is
+}
+
+// add an event to the IRQ trace, val1 is the first value of the event
+func (it *irqTrace) add(time float64, id uint16, val1 uint32, first bool) {
+	if first {
+		it.first = time
+	}
+	it.last = time
+	table := it.table
+	it.table = false
+
+	switch id {
+	case idIrqTable:
+		it.tableTime = time
+		it.table = true
+	case idIrqTrace:
+		if table { // recorded back-to-back with the relocation
+			it.overhead = time - it.tableTime
+		}
+	case idIrqEntry:
+		it.active = append(it.active, irqActive{n: val1, start: time})
+		is := it.get(val1)
+		if len(it.active) > is.nesting {
+			is.nesting = len(it.active)
+		}
+	case idIrqExit:
+		// discard exceptions without exit event (lost events)
+		i := len(it.active) - 1
+		for i >= 0 && it.active[i].n != val1 {
+			i--
+		}
+		if i < 0 { // entry event is lost
+			return
+		}
+		a := it.active[i]
+		it.active = it.active[:i]
+		diff := time - a.start
+		is := it.get(val1)
+		is.count++
+		is.tot += diff - a.nested
+		if diff > is.max {
+			is.max = diff
+			is.maxTime = a.start
+		}
+		if i > 0 {
+			it.active[i-1].nested += diff
+		}
+	}
+}
+
+// get the load (percentage of time) of an exception
+func (it *irqTrace) getLoad(is *irqStatistic) float64 {
+	if it.last <= it.first {
+		return 0
+	}
+	return 100 * is.tot / (it.last - it.first)
+}
+
+type InterruptStatistic struct {
+	Irq        string  `json:"irq" xml:"irq"`
+	Count      int     `json:"count" xml:"count"`
+	Total      string  `json:"total" xml:"total"`
+	Load       float64 `json:"load" xml:"load"` // percentage of time
+	MaxLatency string  `json:"maxLatency" xml:"maxLatency"`
+	MaxTime    float64 `json:"maxTime" xml:"maxTime"`
+	Nesting    int     `json:"nesting" xml:"nesting"`
+}
+
+func (it *irqTrace) statistics() []InterruptStatistic {
+	ns := make([]int, 0, len(it.irqs))
+	for n, is := range it.irqs {
+		if is.count != 0 {
+			ns = append(ns, int(n))
+		}
+	}
+	sort.Ints(ns)
+	var iss []InterruptStatistic
+	for _, n := range ns {
+		is := it.irqs[uint32(n)]
+		iss = append(iss, InterruptStatistic{
+			Irq:        exceptionName(uint32(n)),
+			Count:      is.count,
+			Total:      convertUnit(is.tot, "s"),
+			Load:       it.getLoad(is),
+			MaxLatency: convertUnit(is.max, "s"),
+			MaxTime:    is.maxTime,
+			Nesting:    is.nesting,
+		})
+	}
+	return iss
+}
+
+func (it *irqTrace) print(out *bufio.Writer, eventTable *EventsTable) error {
+	eventTable.Interrupts = it.statistics()
+	if len(eventTable.Interrupts) == 0 {
+		return nil
+	}
+	if len(eventTable.Statistics) == 0 { // separate from header of Start/Stop event statistic
+		if err := conditionalWrite(out, "\n"); err != nil {
+			return err
+		}
+	}
+	if err := conditionalWrite(out, "   Interrupt statistic\n"); err != nil {
+		return err
+	}
+	if err := conditionalWrite(out, "   -------------------\n\n"); err != nil {
+		return err
+	}
+	if err := conditionalWrite(out, "IRQ          count      total     load    max latency  nesting\n"); err != nil {
+		return err
+	}
+	if err := conditionalWrite(out, "---          -----      -----     ----    -----------  -------\n"); err != nil {
+		return err
+	}
+	for _, is := range eventTable.Interrupts {
+		err := conditionalWrite(out, "%-12s %5d %s %6.2f%% %s %4d\n",
+			is.Irq, is.Count, is.Total, is.Load, is.MaxLatency, is.Nesting)
+		if err != nil {
+			return err
+		}
+	}
+	if it.overhead != 0 {
+		eventTable.IrqOverhead = 2 * it.overhead
+		err := conditionalWrite(out, "\n      Trampoline overhead: %s per interrupt (2 event records)\n",
+			strings.TrimSpace(convertUnit(eventTable.IrqOverhead, "s")))
+		if err != nil {
+			return err
+		}
+	}
+	return conditionalWrite(out, "\n")
+}
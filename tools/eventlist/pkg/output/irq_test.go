@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package output
+
+import (
+	"eventlist/pkg/event"
+	"eventlist/pkg/xml/scvd"
+	"math"
+	"testing"
+)
+
+func Test_exceptionName(t *testing.T) {
+	t.Parallel()
+
+	tests := []struct {
+		n    uint32
+		want string
+	}{
+		{2, "NMI"},
+		{15, "SysTick"},
+		{8, "Exc(8)"},
+		{16, "IRQ(0)"},
+		{81, "IRQ(65)"},
+	}
+	for _, tt := range tests {
+		if got := exceptionName(tt.n); got != tt.want {
+			t.Errorf("exceptionName(%d) = %v, want %v", tt.n, got, tt.want)
+		}
+	}
+}
+
+func Test_irqTrace_add(t *testing.T) {
+	t.Parallel()
+
+	var it irqTrace
+	it.init()
+	it.add(1, idIrqEntry, 16, true)
+	it.add(2, idIrqEntry, 17, false) // nested
+	it.add(5, idIrqEntry, 18, false) // exit event lost
+	it.add(6, idIrqExit, 17, false)
+	it.add(9, idIrqExit, 16, false)
+	it.add(10, idIrqExit, 19, false) // entry event lost
+	if len(it.active) != 0 {
+		t.Errorf("irqTrace.add() active = %v, want none", it.active)
+	}
+	tests := []struct {
+		n       uint32
+		count   int
+		tot     float64
+		max     float64
+		nesting int
+	}{
+		{16, 1, 4, 8, 1},
+		{17, 1, 4, 4, 2},
+		{18, 0, 0, 0, 3},
+	}
+	for _, tt := range tests {
+		is := it.get(tt.n)
+		if is.count != tt.count || is.tot != tt.tot || is.max != tt.max || is.nesting != tt.nesting {
+			t.Errorf("irqTrace.add() %s = %v, want %v", exceptionName(tt.n), *is, tt)
+		}
+	}
+	if _, ok := it.irqs[19]; ok {
+		t.Errorf("irqTrace.add() IRQ(3) without entry event counted")
+	}
+	if load := it.getLoad(it.get(16)); load != 100*4.0/9 {
+		t.Errorf("irqTrace.getLoad() = %v, want %v", load, 100*4.0/9)
+	}
+}
+
+func TestOutput_buildStatisticIrq(t *testing.T) { //nolint:golint,paralleltest
+	var s21 = "../../testdata/test21.binary"
+
+	o := &Output{
+		columns: []string{"Index", "Time (s)", "Component", "Event Property", "Value"},
+	}
+	TimeFactor = nil
+	var b event.Binary
+	in := b.Open(&s21)
+	if got := o.buildStatistic(in, map[uint16]scvd.Event{}, nil); got != 47 {
+		t.Errorf("Output.buildStatistic() = %v, want %v", got, 47)
+	}
+	b.Close()
+	// simulated timer: 1MHz, each timestamp takes 1 tick; SysTick 10 ticks, IRQ(0) 30 ticks,
+	// IRQ(1) 40 ticks with nested IRQ(0)
+	if math.Abs(o.irq.overhead-1e-6) > 1e-12 {
+		t.Errorf("Output.buildStatistic() overhead = %v, want %v", o.irq.overhead, 1e-6)
+	}
+	tests := []struct {
+		n       uint32
+		count   int
+		tot     float64
+		max     float64
+		nesting int
+	}{
+		{15, 5, 55e-6, 11e-6, 1},
+		{16, 10, 310e-6, 31e-6, 2},
+		{17, 5, 210e-6, 73e-6, 1},
+	}
+	for _, tt := range tests {
+		is, ok := o.irq.irqs[tt.n]
+		if !ok {
+			t.Fatalf("Output.buildStatistic() %s missing", exceptionName(tt.n))
+		}
+		if is.count != tt.count || math.Abs(is.tot-tt.tot) > 1e-12 || math.Abs(is.max-tt.max) > 1e-12 || is.nesting != tt.nesting {
+			t.Errorf("Output.buildStatistic() %s = %v, want %v", exceptionName(tt.n), *is, tt)
+		}
+	}
+	if iss := o.irq.statistics(); len(iss) != 3 || iss[0].Irq != "SysTick" || iss[2].Irq != "IRQ(1)" {
+		t.Errorf("irqTrace.statistics() = %v", iss)
+	}
+}
@@ -24,12 +24,16 @@ import (
 	"encoding/json"
 	"encoding/xml"
 	"errors"
+	"eventlist/pkg/elf"
 	"eventlist/pkg/eval"
 	"eventlist/pkg/event"
 	"eventlist/pkg/xml/scvd"
 	"fmt"
 	"math"
+	"math/bits"
 	"os"
+	"sort"
+	"strings"
 )
 
 var errNoEvents = errors.New("cannot open event file")
@@ -64,6 +68,32 @@ type eventStatistic struct {
 	textMinE  string
 	textMaxB  string
 	textMaxE  string
+	name      string
+	hist      [histBuckets]int // duration histogram (log2 bucket limits)
+	histBase  int              // first bucket limit: 2^histBase timer ticks
+	target    bool             // true if statistic is recorded by the target
+	energy    float64          // energy in J, recorded by the target
+	hasEnergy bool             // true if energy is recorded by the target
+	thread    uint8            // thread index of the last start event
+	threads   map[uint8]*threadStatistic
+}
+
+// statistic of the Start/Stop pairs that are started by a thread
+type threadStatistic struct {
+	count int
+	tot   float64
+}
+
+const histBuckets = 16 // number of buckets of the duration histogram
+
+// get the histogram bucket of a duration: bucket 0 < 2^base ticks, each further bucket doubles the limit
+func histBucket(diff float64, base int) int {
+	ticks := uint64(diff/TimeInSecs(1) + 0.5)
+	b := bits.Len64(ticks >> base)
+	if b > histBuckets-1 {
+		b = histBuckets - 1
+	}
+	return b
 }
 
 type EventRecord struct {
@@ -72,35 +102,57 @@ type EventRecord struct {
 	Component     string  `json:"component" xml:"component"`
 	EventProperty string  `json:"eventProperty" xml:"eventProperty"`
 	Value         string  `json:"value" xml:"value"`
+	Thread        string  `json:"thread,omitempty" xml:"thread,omitempty"`
 }
 
 type EventRecordStatistic struct {
-	Event       string  `json:"event" xml:"event"`
-	Count       int     `json:"count" xml:"count"`
-	AddCount    string  `json:"addCount" xml:"addCount"`
-	Start       string  `json:"start" xml:"start"`
-	MinStopTime float64 `json:"minStopTime" xml:"minStopTime"`
-	MaxStopTime float64 `json:"maxStopTime" xml:"maxStopTime"`
-	Total       string  `json:"total" xml:"total"`
-	Min         string  `json:"min" xml:"min"`
-	Max         string  `json:"max" xml:"max"`
-	First       string  `json:"first" xml:"first"`
-	Last        string  `json:"last" xml:"last"`
-	Avg         string  `json:"avg" xml:"avg"`
-	MinTime     float64 `json:"minTime" xml:"minTime"`
-	MaxTime     float64 `json:"maxTime" xml:"maxTime"`
-	FirstTime   string  `json:"firstTime" xml:"firstTime"`
-	LastTime    string  `json:"lastTime" xml:"lastTime"`
-	TextB       string  `json:"textB" xml:"textB"`
-	TextMinB    string  `json:"textMinB" xml:"textMinB"`
-	TextMinE    string  `json:"textMinE" xml:"textMinE"`
-	TextMaxB    string  `json:"textMaxB" xml:"textMaxB"`
-	TextMaxE    string  `json:"textMaxE" xml:"textMaxE"`
+	Event       string            `json:"event" xml:"event"`
+	Count       int               `json:"count" xml:"count"`
+	AddCount    string            `json:"addCount" xml:"addCount"`
+	Start       string            `json:"start" xml:"start"`
+	MinStopTime float64           `json:"minStopTime" xml:"minStopTime"`
+	MaxStopTime float64           `json:"maxStopTime" xml:"maxStopTime"`
+	Total       string            `json:"total" xml:"total"`
+	Min         string            `json:"min" xml:"min"`
+	Max         string            `json:"max" xml:"max"`
+	First       string            `json:"first" xml:"first"`
+	Last        string            `json:"last" xml:"last"`
+	Avg         string            `json:"avg" xml:"avg"`
+	MinTime     float64           `json:"minTime" xml:"minTime"`
+	MaxTime     float64           `json:"maxTime" xml:"maxTime"`
+	FirstTime   string            `json:"firstTime" xml:"firstTime"`
+	LastTime    string            `json:"lastTime" xml:"lastTime"`
+	TextB       string            `json:"textB" xml:"textB"`
+	TextMinB    string            `json:"textMinB" xml:"textMinB"`
+	TextMinE    string            `json:"textMinE" xml:"textMinE"`
+	TextMaxB    string            `json:"textMaxB" xml:"textMaxB"`
+	TextMaxE    string            `json:"textMaxE" xml:"textMaxE"`
+	Name        string            `json:"name,omitempty" xml:"name,omitempty"`
+	Histogram   []HistogramBucket `json:"histogram,omitempty" xml:"histogram,omitempty"`
+	Energy      float64           `json:"energy,omitempty" xml:"energy,omitempty"` // energy in J
+	Power       float64           `json:"power,omitempty" xml:"power,omitempty"`   // average power in W
+	Threads     []ThreadStatistic `json:"threads,omitempty" xml:"threads,omitempty"`
+}
+
+type ThreadStatistic struct {
+	Thread string `json:"thread" xml:"thread"`
+	Count  int    `json:"count" xml:"count"`
+	Total  string `json:"total" xml:"total"`
+	Avg    string `json:"avg" xml:"avg"`
+}
+
+type HistogramBucket struct {
+	From  float64 `json:"from" xml:"from"`   // lower limit of duration in seconds
+	Below float64 `json:"below" xml:"below"` // upper limit of duration in seconds, 0 = no limit
+	Count int     `json:"count" xml:"count"`
 }
 
 type EventsTable struct {
-	Events     []EventRecord          `json:"events" xml:"events"`
-	Statistics []EventRecordStatistic `json:"statistics" xml:"statistics"`
+	Events      []EventRecord          `json:"events" xml:"events"`
+	Statistics  []EventRecordStatistic `json:"statistics" xml:"statistics"`
+	Interrupts  []InterruptStatistic   `json:"interrupts,omitempty" xml:"interrupts,omitempty"`
+	IrqOverhead float64                `json:"irqOverhead,omitempty" xml:"irqOverhead,omitempty"` // trampoline overhead in s
+	Profile     *RecorderProfile       `json:"profile,omitempty" xml:"profile,omitempty"`
 }
 
 func (es *eventStatistic) init() {
@@ -116,9 +168,19 @@ func (es *eventStatistic) init() {
 	es.maxTime = 0
 	es.firstTime = 0
 	es.lastTime = 0
+	es.hist = [histBuckets]int{}
+	es.target = false
+	es.energy = 0
+	es.hasEnergy = false
+	es.thread = 0
+	es.threads = nil
 }
 
-func (es *eventStatistic) add(time float64, start bool, text string) {
+// add a Start or Stop event of a slot, thread is the thread index of the event (0 = IRQ or unknown thread)
+func (es *eventStatistic) add(time float64, start bool, text string, thread uint8) {
+	if es.target {
+		return // statistic is recorded by the target
+	}
 	if start {
 		if es.evStart {
 			return // ignore start event, was not stopped yet
@@ -126,66 +188,178 @@ func (es *eventStatistic) add(time float64, start bool, text string) {
 		es.evStart = true
 		es.start = time
 		es.textB = text
+		es.thread = thread
 	} else {
 		if !es.evStart {
 			return // ignore already stopped events
 		}
 		es.evStart = false
-		diff := time - es.start
-		if diff < es.min {
-			es.min = diff
-			es.minTime = es.start
-			es.textMinB = es.textB
-			es.textMinE = text
+		es.stop(time-es.start, text)
+	}
+}
+
+// add a Stop event with the duration measured by the target (Start event is not recorded)
+func (es *eventStatistic) addDuration(time float64, diff float64, text string, thread uint8) {
+	if es.target {
+		return // statistic is recorded by the target
+	}
+	es.evStart = false
+	es.start = time - diff
+	es.textB = ""
+	es.thread = thread
+	es.stop(diff, text)
+}
+
+// add the duration of a Start/Stop pair, text is the text of the Stop event
+func (es *eventStatistic) stop(diff float64, text string) {
+	if diff < es.min {
+		es.min = diff
+		es.minTime = es.start
+		es.textMinB = es.textB
+		es.textMinE = text
+	}
+	if diff > es.max {
+		es.max = diff
+		es.maxTime = es.start
+		es.textMaxB = es.textB
+		es.textMaxE = text
+	}
+	if !es.evFirst {
+		es.first = diff
+		es.firstTime = es.start
+		es.evFirst = true
+	}
+	es.last = diff
+	es.lastTime = es.start
+	es.tot += diff
+	es.avg += diff
+	es.count++
+	es.hist[histBucket(diff, es.histBase)]++
+	if es.thread != 0 { // pair is started by a thread
+		if es.threads == nil {
+			es.threads = make(map[uint8]*threadStatistic)
 		}
-		if diff > es.max {
-			es.max = diff
-			es.maxTime = es.start
-			es.textMaxB = es.textB
-			es.textMaxE = text
+		ts, ok := es.threads[es.thread]
+		if !ok {
+			ts = new(threadStatistic)
+			es.threads[es.thread] = ts
 		}
-		if !es.evFirst {
-			es.first = diff
-			es.firstTime = es.start
-			es.evFirst = true
+		ts.count++
+		ts.tot += diff
+	}
+}
+
+// set the statistic from a snapshot recorded by the target (times in timer ticks),
+// used only when no Start/Stop events of the slot are recorded
+func (es *eventStatistic) setTarget(count, avg, min, max uint32) {
+	if es.count != 0 && !es.target {
+		return
+	}
+	es.target = true
+	es.evFirst = count != 0
+	es.count = int(count)
+	es.avg = TimeInSecs(uint64(avg)) * float64(count)
+	es.tot = es.avg
+	es.min = TimeInSecs(uint64(min))
+	es.max = TimeInSecs(uint64(max))
+}
+
+// set the duration histogram from a record of the target:
+// first bucket limit (log2), number of buckets, 2 reserved bytes, 16-bit bucket counts
+func (es *eventStatistic) setHistogram(data []uint8) {
+	if len(data) < 4 {
+		return
+	}
+	es.histBase = int(data[0])
+	es.hist = [histBuckets]int{}
+	for k := 0; k < int(data[1]) && k < histBuckets && 5+2*k < len(data); k++ {
+		es.hist[k] = int(data[4+2*k]) | int(data[5+2*k])<<8
+	}
+}
+
+// set the energy from a snapshot recorded by the target (energy in uW * timer ticks)
+func (es *eventStatistic) setEnergy(lo, hi uint32) {
+	es.hasEnergy = true
+	es.energy = float64(uint64(hi)<<32|uint64(lo)) * 1e-6 * TimeInSecs(1)
+}
+
+// get the average power of the Start/Stop pairs in W
+func (es *eventStatistic) getPower() float64 {
+	if es.tot <= 0 {
+		return 0
+	}
+	return es.energy / es.tot
+}
+
+// get the non-empty buckets of the duration histogram
+func (es *eventStatistic) getHistogram() []HistogramBucket {
+	var hb []HistogramBucket
+	for k, n := range es.hist {
+		if n != 0 {
+			var from, below float64
+			if k > 0 {
+				from = TimeInSecs(uint64(1) << (es.histBase + k - 1))
+			}
+			if k < histBuckets-1 {
+				below = TimeInSecs(uint64(1) << (es.histBase + k))
+			}
+			hb = append(hb, HistogramBucket{From: from, Below: below, Count: n})
 		}
-		es.last = diff
-		es.lastTime = es.start
-		es.tot += diff
-		es.avg += diff
-		es.count++
 	}
+	return hb
 }
 
+const groupX = 4 // group of extended statistics (EventStartX/EventStopX)
+
 type eventProperty struct {
-	values [16]eventStatistic
+	values  map[uint16]*eventStatistic
+	stopAll bool // true if stop of slot 15 stops all slots (groups A..D)
 }
 
 func (ep *eventProperty) init() {
-	for i := uint16(0); i < uint16(len(ep.values)); i++ {
-		ep.values[i].init()
+	ep.values = make(map[uint16]*eventStatistic)
+}
+
+// get the statistic of a slot, create it when used first time
+func (ep *eventProperty) get(idx uint16) *eventStatistic {
+	es, ok := ep.values[idx]
+	if !ok {
+		es = new(eventStatistic)
+		es.init()
+		ep.values[idx] = es
+	}
+	return es
+}
+
+// get the used slots in ascending order
+func (ep *eventProperty) slots() []uint16 {
+	idxs := make([]uint16, 0, len(ep.values))
+	for idx := range ep.values {
+		idxs = append(idxs, idx)
 	}
+	sort.Slice(idxs, func(i, j int) bool { return idxs[i] < idxs[j] })
+	return idxs
 }
 
-func (ep *eventProperty) add(time float64, idx uint16, start bool, text string) {
-	if idx == 15 && !start { // stop 15 means stop all
-		for i := uint16(0); i < uint16(len(ep.values)); i++ {
-			ep.values[i].add(time, start, text)
+func (ep *eventProperty) add(time float64, idx uint16, start bool, text string, thread uint8) {
+	if ep.stopAll && idx == 15 && !start { // stop 15 means stop all
+		for _, es := range ep.values {
+			es.add(time, start, text, thread)
 		}
 	} else {
-		ep.values[idx].add(time, start, text)
+		ep.get(idx).add(time, start, text, thread)
 	}
 }
 
 func (ep *eventProperty) getCount(idx uint16) int {
-	if int(idx) >= len(ep.values) {
-		return 0
+	if es, ok := ep.values[idx]; ok {
+		return es.count
 	}
-	return ep.values[idx].count
+	return 0
 }
 
 func (ep *eventProperty) getAddCount(idx uint16) string {
-	if int(idx) < len(ep.values) && ep.values[idx].evStart {
+	if es, ok := ep.values[idx]; ok && es.evStart {
 		return "+1"
 	}
 	return "  "
@@ -245,19 +419,83 @@ func (ep *eventProperty) getLast(idx uint16) string {
 }
 
 type Output struct {
-	evProps       [4]eventProperty
+	evProps       map[uint16]*eventProperty // key is group: 0..3 = A..D, groupX = X
 	columns       []string
 	componentSize int
 	propertySize  int
+	threads       map[uint8]string // thread names, key is thread index
+	threadSize    int              // width of thread column, 0 = events are not tagged with threads
+	irq           irqTrace         // statistic of traced interrupts
+	profile       recorderProfile  // recorder self-profiling snapshot
+}
+
+// get the name of the thread that recorded an event
+func (o *Output) threadName(info *event.Info) string {
+	switch {
+	case info.Thread != 0:
+		if name, ok := o.threads[info.Thread]; ok {
+			return name
+		}
+		return fmt.Sprintf("#%d", info.Thread)
+	case info.IsIRQ():
+		return "IRQ"
+	}
+	return "-"
+}
+
+// get the statistic of the threads that started Start/Stop pairs of a slot
+func (o *Output) getThreads(es *eventStatistic) []ThreadStatistic {
+	idxs := make([]int, 0, len(es.threads))
+	for idx := range es.threads {
+		idxs = append(idxs, int(idx))
+	}
+	sort.Ints(idxs)
+	var tss []ThreadStatistic
+	for _, idx := range idxs {
+		ts := es.threads[uint8(idx)]
+		tss = append(tss, ThreadStatistic{
+			Thread: o.threadName(&event.Info{Thread: uint8(idx)}),
+			Count:  ts.count,
+			Total:  strings.TrimSpace(convertUnit(ts.tot, "s")),
+			Avg:    strings.TrimSpace(convertUnit(ts.tot/float64(ts.count), "s")),
+		})
+	}
+	return tss
+}
+
+// get the statistic properties of a group, create them when used first time
+func (o *Output) property(group uint16) *eventProperty {
+	if o.evProps == nil {
+		o.evProps = make(map[uint16]*eventProperty)
+	}
+	ep, ok := o.evProps[group]
+	if !ok {
+		ep = &eventProperty{stopAll: group < groupX}
+		ep.init()
+		o.evProps[group] = ep
+	}
+	return ep
+}
+
+// get the used groups in ascending order
+func (o *Output) groups() []uint16 {
+	groups := make([]uint16, 0, len(o.evProps))
+	for group := range o.evProps {
+		groups = append(groups, group)
+	}
+	sort.Slice(groups, func(i, j int) bool { return groups[i] < groups[j] })
+	return groups
 }
 
 func (o *Output) buildStatistic(in *bufio.Reader, evdefs map[uint16]scvd.Event,
 	typedefs map[string]map[string]map[int16]string) int {
 	o.componentSize = len(o.columns[2]) // use minimum width of header
 	o.propertySize = len(o.columns[3])
-	for i := uint16(0); i < uint16(len(o.evProps)); i++ {
-		o.evProps[i].init()
-	}
+	o.evProps = make(map[uint16]*eventProperty)
+	o.threads = make(map[uint8]string)
+	o.threadSize = 0
+	o.irq.init()
+	o.profile.init()
 	var beforeClockEvent float64
 	var lastClockEvent uint64
 	var eventCount int
@@ -271,6 +509,9 @@ func (o *Output) buildStatistic(in *bufio.Reader, evdefs map[uint16]scvd.Event,
 			return 0
 		}
 		eventCount++
+		if ev.Info.Thread != 0 && o.threadSize == 0 {
+			o.threadSize = len("Thread")
+		}
 		var evdef scvd.Event
 		var ok bool
 		var rep string
@@ -282,20 +523,65 @@ func (o *Output) buildStatistic(in *bufio.Reader, evdefs map[uint16]scvd.Event,
 				o.propertySize = len(evdef.Property)
 			}
 			class, _, _, _ := ev.Info.SplitID()
-			switch class {
-			case 0xEF:
+			switch {
+			case class == 0xEF, ev.Info.ID == 0xFF11, ev.Info.ID == 0xFF12, ev.Info.ID == 0xFF13:
 				rep, _ = ev.EvalLine(evdef, typedefs)
 			}
 		}
 		class, group, idx, start := ev.Info.SplitID()
+		o.irq.add(beforeClockEvent+TimeInSecs(ev.Time-lastClockEvent), ev.Info.ID, uint32(ev.Value1), eventCount == 1)
+		if eventCount == 1 {
+			o.profile.first = beforeClockEvent + TimeInSecs(ev.Time-lastClockEvent)
+		}
 		switch class {
 		case 0xEF:
 			if !ok { // rep not yet built up because of wrong or missing SCVD files
 				rep = ev.GetValuesAsString()
 			}
-			o.evProps[group].add(beforeClockEvent+TimeInSecs(ev.Time-lastClockEvent), idx, start, rep)
+			o.property(group).add(beforeClockEvent+TimeInSecs(ev.Time-lastClockEvent), idx, start, rep, ev.Info.Thread)
 		case 0xFF:
+			switch mid := ev.Info.ID & 0xFF; {
+			case mid >= 0x40 && mid < 0x80: // Execution statistics snapshot (0xFF40 + 16*group + slot)
+				mid -= 0x40
+				o.property(mid>>4).get(mid&0xF).setTarget(uint32(ev.Value1), uint32(ev.Value2),
+					uint32(ev.Value3), uint32(ev.Value4))
+			case mid >= 0x80 && mid < 0xC0 && ev.Data != nil: // Duration histogram (0xFF80 + 16*group + slot)
+				mid -= 0x80
+				o.property(mid >> 4).get(mid & 0xF).setHistogram(*ev.Data)
+			case mid >= 0xC0: // Energy (0xFFC0 + 16*group + slot)
+				mid -= 0xC0
+				o.property(mid>>4).get(mid&0xF).setEnergy(uint32(ev.Value1), uint32(ev.Value2))
+			}
 			switch ev.Info.ID {
+			case 0xFF10: // EventStatisticsRegister
+				name := elf.Sections.GetString(uint64(uint32(ev.Value2)))
+				if len(name) == 0 {
+					name = fmt.Sprintf("%08x", uint32(ev.Value2))
+				}
+				o.property(groupX).get(uint16(ev.Value1)).name = name
+			case 0xFF11, 0xFF12: // EventStatisticsStart, EventStatisticsStop
+				if !ok { // rep not yet built up because of wrong or missing SCVD files
+					rep = ev.GetValuesAsString()
+				}
+				o.property(groupX).add(beforeClockEvent+TimeInSecs(ev.Time-lastClockEvent),
+					uint16(ev.Value1), ev.Info.ID == 0xFF11, rep, ev.Info.Thread)
+			case 0xFF13: // Duration of Start/Stop pair (val1 = 16*group + slot, val2 = duration)
+				if !ok {
+					rep = ev.GetValuesAsString()
+				}
+				slot := uint16(ev.Value1) & 0x3F
+				o.property(slot>>4).get(slot&0xF).addDuration(beforeClockEvent+TimeInSecs(ev.Time-lastClockEvent),
+					TimeInSecs(uint64(uint32(ev.Value2))), rep, ev.Info.Thread)
+			case idProfile: // Recorder self-profiling snapshot
+				if ev.Data != nil {
+					o.profile.set(beforeClockEvent+TimeInSecs(ev.Time-lastClockEvent), *ev.Data)
+				}
+			case 0xFF05: // Thread index registered
+				name := elf.Sections.GetString(uint64(uint32(ev.Value3)))
+				if len(name) == 0 {
+					name = fmt.Sprintf("%08x", uint32(ev.Value2))
+				}
+				o.threads[uint8(ev.Value1)] = name
 			case 0xFF00: // EventRecorderInitialize
 				if ev.Value2 != 0 {
 					beforeClockEvent = TimeInSecs(ev.Time)
@@ -317,6 +603,13 @@ func (o *Output) buildStatistic(in *bufio.Reader, evdefs map[uint16]scvd.Event,
 			}
 		}
 	}
+	if o.threadSize != 0 {
+		for _, name := range o.threads {
+			if len(name) > o.threadSize {
+				o.threadSize = len(name)
+			}
+		}
+	}
 	return eventCount
 }
 
@@ -344,32 +637,43 @@ func (o *Output) printStatistic(out *bufio.Writer, eventCount int, eventTable *E
 		if err = conditionalWrite(out, "----- -----      -----       ---         ---         -------     -----       ----\n"); err != nil {
 			return err
 		}
-		for i := uint16(0); i < uint16(len(o.evProps)); i++ {
-			for j := uint16(0); j < uint16(len(o.evProps[i].values)); j++ {
-				if o.evProps[i].values[j].evFirst {
+		for _, i := range o.groups() {
+			ep := o.evProps[i]
+			for _, j := range ep.slots() {
+				es := ep.values[j]
+				if es.evFirst {
 					eventStat := EventRecordStatistic{
 						Event:       fmt.Sprintf("%c(%d)", byte(i+'A'), j),
-						AddCount:    o.evProps[i].getAddCount(j),
-						Count:       o.evProps[i].getCount(j),
-						Total:       o.evProps[i].getTot(j),
-						Min:         o.evProps[i].getMin(j),
-						Max:         o.evProps[i].getMax(j),
-						Avg:         o.evProps[i].getAvg(j),
-						First:       o.evProps[i].getFirst(j),
-						Last:        o.evProps[i].getLast(j),
-						MinTime:     o.evProps[i].values[j].minTime,
-						TextMinB:    o.evProps[i].values[j].textMinB,
-						TextMinE:    o.evProps[i].values[j].textMinE,
-						MinStopTime: o.evProps[i].values[j].minTime + o.evProps[i].values[j].min,
-						MaxStopTime: o.evProps[i].values[j].maxTime + o.evProps[i].values[j].max,
-						MaxTime:     o.evProps[i].values[j].maxTime,
-						TextMaxB:    o.evProps[i].values[j].textMaxB,
-						TextMaxE:    o.evProps[i].values[j].textMaxE,
+						AddCount:    ep.getAddCount(j),
+						Count:       ep.getCount(j),
+						Total:       ep.getTot(j),
+						Min:         ep.getMin(j),
+						Max:         ep.getMax(j),
+						Avg:         ep.getAvg(j),
+						First:       ep.getFirst(j),
+						Last:        ep.getLast(j),
+						MinTime:     es.minTime,
+						TextMinB:    es.textMinB,
+						TextMinE:    es.textMinE,
+						MinStopTime: es.minTime + es.min,
+						MaxStopTime: es.maxTime + es.max,
+						MaxTime:     es.maxTime,
+						TextMaxB:    es.textMaxB,
+						TextMaxE:    es.textMaxE,
+						Name:        es.name,
+						Histogram:   es.getHistogram(),
+					}
+					if es.hasEnergy {
+						eventStat.Energy = es.energy
+						eventStat.Power = es.getPower()
+					}
+					if o.threadSize != 0 {
+						eventStat.Threads = o.getThreads(es)
 					}
-					err = conditionalWrite(out, eventStat.Event)
-					if err == nil && j < 10 {
-						err = conditionalWrite(out, " ")
+					if i == groupX {
+						eventStat.Event = fmt.Sprintf("X(%d)", j)
 					}
+					err = conditionalWrite(out, "%-5s", eventStat.Event)
 					if err != nil {
 						return err
 					}
@@ -385,30 +689,77 @@ func (o *Output) printStatistic(out *bufio.Writer, eventCount int, eventTable *E
 					if err != nil {
 						return err
 					}
-					err = conditionalWrite(out, "      Min: Start: %.8f %s Stop: %.8f %s\n",
-						eventStat.MinTime,
-						eventStat.TextMinB,
-						eventStat.MinStopTime,
-						eventStat.TextMinE)
-					if err != nil {
-						return err
+					if len(eventStat.Name) != 0 {
+						if err = conditionalWrite(out, "      Name: %s\n", eventStat.Name); err != nil {
+							return err
+						}
 					}
-					err = conditionalWrite(out, "      Max: Start: %.8f %s Stop: %.8f %s\n\n",
-						eventStat.MaxTime,
-						eventStat.TextMaxB,
-						eventStat.MaxStopTime,
-						eventStat.TextMaxE)
-					if err != nil {
+					if !es.target { // times of min/max are not known for statistics recorded by the target
+						err = conditionalWrite(out, "      Min: Start: %.8f %s Stop: %.8f %s\n",
+							eventStat.MinTime,
+							eventStat.TextMinB,
+							eventStat.MinStopTime,
+							eventStat.TextMinE)
+						if err != nil {
+							return err
+						}
+						err = conditionalWrite(out, "      Max: Start: %.8f %s Stop: %.8f %s\n",
+							eventStat.MaxTime,
+							eventStat.TextMaxB,
+							eventStat.MaxStopTime,
+							eventStat.TextMaxE)
+						if err != nil {
+							return err
+						}
+					}
+					if len(eventStat.Histogram) != 0 {
+						if err = conditionalWrite(out, "      Hist: %s\n", formatHistogram(eventStat.Histogram)); err != nil {
+							return err
+						}
+					}
+					for _, ts := range eventStat.Threads {
+						err = conditionalWrite(out, "      Thread: %-*s count: %d total: %s avg: %s\n",
+							o.threadSize, ts.Thread, ts.Count, ts.Total, ts.Avg)
+						if err != nil {
+							return err
+						}
+					}
+					if es.hasEnergy {
+						err = conditionalWrite(out, "      Energy: %s Power: %s\n",
+							strings.TrimSpace(convertUnit(eventStat.Energy, "J")),
+							strings.TrimSpace(convertUnit(eventStat.Power, "W")))
+						if err != nil {
+							return err
+						}
+					}
+					if err = conditionalWrite(out, "\n"); err != nil {
 						return err
 					}
 					eventTable.Statistics = append(eventTable.Statistics, eventStat)
 				}
 			}
 		}
+		if err = o.irq.print(out, eventTable); err != nil {
+			return err
+		}
+		err = o.profile.print(out, eventTable)
 	}
 	return err
 }
 
+// format the duration histogram: "<limit: count" for each non-empty bucket, ">=limit: count" for the last bucket
+func formatHistogram(hb []HistogramBucket) string {
+	items := make([]string, 0, len(hb))
+	for _, b := range hb {
+		if b.Below != 0 {
+			items = append(items, fmt.Sprintf("<%s: %d", strings.TrimSpace(convertUnit(b.Below, "s")), b.Count))
+		} else {
+			items = append(items, fmt.Sprintf(">=%s: %d", strings.TrimSpace(convertUnit(b.From, "s")), b.Count))
+		}
+	}
+	return strings.Join(items, ", ")
+}
+
 func escapeGen(s string) string {
 	var t string
 	for _, c := range s {
@@ -444,12 +795,40 @@ func escapeGen(s string) string {
 	return t
 }
 
+// repeat count of events coalesced by the target (val1 = number of repeats, val2 = ID of repeated event)
+const idRepeat = 0xFF15
+
+// last events with two values (EventRecord2) of each ID, which can be repeated
+type eventRepeats map[uint16]event.Data
+
+// replace a repeat count event by the repeated event at the time of the last repeat,
+// return the note "×N " for the value of the repeated event
+func (r *eventRepeats) expand(ev *event.Data) string {
+	if *r == nil {
+		*r = make(eventRepeats)
+	}
+	switch {
+	case ev.Info.ID == idRepeat:
+		if last, ok := (*r)[uint16(ev.Value2)]; ok {
+			count := uint32(ev.Value1)
+			last.Time = ev.Time
+			*ev = last
+			return fmt.Sprintf("×%d ", count)
+		}
+	case ev.Typ == 2:
+		(*r)[ev.Info.ID] = *ev
+	}
+	return ""
+}
+
 func (o *Output) printEvents(out *bufio.Writer, in *bufio.Reader, evdefs map[uint16]scvd.Event,
 	typedefs map[string]map[string]map[int16]string, eventTable *EventsTable) error {
 	if out == nil || in == nil {
 		return nil
 	}
 	var err error
+	var frags event.Fragments
+	var repeats eventRepeats
 	no := 0
 	var beforeClockEvent float64
 	var lastClockEvent uint64
@@ -485,54 +864,82 @@ func (o *Output) printEvents(out *bufio.Writer, in *bufio.Reader, evdefs map[uin
 				*TimeFactor = 1.0 / float64(ev.Value1)
 			}
 		}
-		eventRecord := EventRecord{
-			Index: no,
-			Time:  beforeClockEvent + TimeInSecs(ev.Time-lastClockEvent),
+		if ev.Typ == 4 && !frags.Add(&ev) { // EventRecordFragment
+			continue // wait for remaining fragments
 		}
-		var rep string
-		if evdef, ok := evdefs[ev.Info.ID]; ok {
-			eventRecord.Component = evdef.Brief
-			eventRecord.EventProperty = evdef.Property
-			if ev.Info.ID == 0xFE00 && ev.Data != nil { // special case stdout
-				s := escapeGen(string(*ev.Data))
-				eventRecord.Value = s
-				err = conditionalWrite(out, "%5d %.8f %*s %*s \"%s\"\n",
-					eventRecord.Index, eventRecord.Time, -o.componentSize,
-					eventRecord.Component, -o.propertySize, eventRecord.EventProperty, eventRecord.Value)
-			} else {
-				rep, err = ev.EvalLine(evdef, typedefs)
-				if err == nil {
-					eventRecord.Value = rep
-					err = conditionalWrite(out, "%5d %.8f %*s %*s %s\n",
-						eventRecord.Index, eventRecord.Time, -o.componentSize,
-						eventRecord.Component, -o.propertySize, eventRecord.EventProperty, eventRecord.Value)
-				}
+		note := repeats.expand(&ev)
+		err = o.printEvent(out, no, beforeClockEvent+TimeInSecs(ev.Time-lastClockEvent), &ev, note,
+			evdefs, typedefs, eventTable)
+		if err != nil {
+			break
+		}
+		no++
+	}
+	if err == nil {
+		for _, tr := range frags.Incomplete() {
+			note := fmt.Sprintf("incomplete transfer (%d of %d bytes): ", tr.Received, len(*tr.Event.Data))
+			err = o.printEvent(out, no, beforeClockEvent+TimeInSecs(tr.Event.Time-lastClockEvent), &tr.Event, note,
+				evdefs, typedefs, eventTable)
+			if err != nil {
+				break
 			}
+			no++
+		}
+	}
+	return err
+}
+
+func (o *Output) printEvent(out *bufio.Writer, no int, time float64, ev *event.Data, note string,
+	evdefs map[uint16]scvd.Event, typedefs map[string]map[string]map[int16]string, eventTable *EventsTable) error {
+	var err error
+	eventRecord := EventRecord{
+		Index: no,
+		Time:  time,
+	}
+	var rep string
+	th := "" // thread column, only if events are tagged with threads
+	if o.threadSize != 0 {
+		eventRecord.Thread = o.threadName(&ev.Info)
+		th = fmt.Sprintf(" %*s", -o.threadSize, eventRecord.Thread)
+	}
+	if evdef, ok := evdefs[ev.Info.ID]; ok {
+		eventRecord.Component = evdef.Brief
+		eventRecord.EventProperty = evdef.Property
+		if ev.Info.ID == 0xFE00 && ev.Data != nil { // special case stdout
+			s := escapeGen(string(*ev.Data))
+			eventRecord.Value = note + s
+			err = conditionalWrite(out, "%5d %.8f%s %*s %*s \"%s\"\n",
+				eventRecord.Index, eventRecord.Time, th, -o.componentSize,
+				eventRecord.Component, -o.propertySize, eventRecord.EventProperty, eventRecord.Value)
 		} else {
-			eventRecord.Component = fmt.Sprintf("0x%02X%*s", uint8(ev.Info.ID>>8), 0, "")
-			eventRecord.EventProperty = fmt.Sprintf("0x%04X%*s", ev.Info.ID, 0, "")
-			if ev.Info.ID == 0xFE00 && ev.Data != nil { // special case stdout
-				s := escapeGen(string(*ev.Data))
-				eventRecord.Value = s
-				err = conditionalWrite(out, "%5d %.8f 0x%02X%*s 0x%04X%*s \"%s\"\n",
-					eventRecord.Index, eventRecord.Time,
-					uint8(ev.Info.ID>>8), -(o.componentSize - 4), "",
-					ev.Info.ID, -(o.propertySize - 6), "", eventRecord.Value)
-			} else {
-				rep = ev.GetValuesAsString()
-				eventRecord.Value = rep
-				err = conditionalWrite(out, "%5d %.8f 0x%02X%*s 0x%04X%*s %s\n",
-					eventRecord.Index, eventRecord.Time,
-					uint8(ev.Info.ID>>8), -(o.componentSize - 4), "",
-					ev.Info.ID, -(o.propertySize - 6), "", eventRecord.Value)
+			rep, err = ev.EvalLine(evdef, typedefs)
+			if err == nil {
+				eventRecord.Value = note + rep
+				err = conditionalWrite(out, "%5d %.8f%s %*s %*s %s\n",
+					eventRecord.Index, eventRecord.Time, th, -o.componentSize,
+					eventRecord.Component, -o.propertySize, eventRecord.EventProperty, eventRecord.Value)
 			}
 		}
-		eventTable.Events = append(eventTable.Events, eventRecord)
-		if err != nil {
-			break
+	} else {
+		eventRecord.Component = fmt.Sprintf("0x%02X%*s", uint8(ev.Info.ID>>8), 0, "")
+		eventRecord.EventProperty = fmt.Sprintf("0x%04X%*s", ev.Info.ID, 0, "")
+		if ev.Info.ID == 0xFE00 && ev.Data != nil { // special case stdout
+			s := escapeGen(string(*ev.Data))
+			eventRecord.Value = note + s
+			err = conditionalWrite(out, "%5d %.8f%s 0x%02X%*s 0x%04X%*s \"%s\"\n",
+				eventRecord.Index, eventRecord.Time, th,
+				uint8(ev.Info.ID>>8), -(o.componentSize - 4), "",
+				ev.Info.ID, -(o.propertySize - 6), "", eventRecord.Value)
+		} else {
+			rep = ev.GetValuesAsString()
+			eventRecord.Value = note + rep
+			err = conditionalWrite(out, "%5d %.8f%s 0x%02X%*s 0x%04X%*s %s\n",
+				eventRecord.Index, eventRecord.Time, th,
+				uint8(ev.Info.ID>>8), -(o.componentSize - 4), "",
+				ev.Info.ID, -(o.propertySize - 6), "", eventRecord.Value)
 		}
-		no++
 	}
+	eventTable.Events = append(eventTable.Events, eventRecord)
 	return err
 }
 
@@ -544,12 +951,17 @@ func (o *Output) printHeader(out *bufio.Writer) error {
 	if err = conditionalWrite(out, "   -------------------\n\n"); err != nil {
 		return err
 	}
-	err = conditionalWrite(out, "%5s %-10s %*s %*s %s\n", o.columns[0], o.columns[1],
+	th, sep := "", "" // thread column, only if events are tagged with threads
+	if o.threadSize != 0 {
+		th = fmt.Sprintf("%*s ", -o.threadSize, "Thread")
+		sep = fmt.Sprintf("%*s ", -o.threadSize, "------")
+	}
+	err = conditionalWrite(out, "%5s %-10s %s%*s %*s %s\n", o.columns[0], o.columns[1], th,
 		-o.componentSize, o.columns[2], -o.propertySize, o.columns[3], o.columns[4])
 	if err != nil {
 		return err
 	}
-	err = conditionalWrite(out, "----- --------   %*s %*s -----\n",
+	err = conditionalWrite(out, "----- --------   %s%*s %*s -----\n", sep,
 		-o.componentSize, "---------", -o.propertySize, "--------------")
 	return err
 }
@@ -228,7 +228,10 @@ func Test_eventStatistic_add(t *testing.T) {
 				textMaxB: tt.fields.textMaxB,
 				textMaxE: tt.fields.textMaxE,
 			}
-			es.add(tt.args.time, tt.args.start, tt.args.text)
+			es.add(tt.args.time, tt.args.start, tt.args.text, 0)
+			if tt.want.count != 0 { // stop event counts duration in histogram
+				tt.want.hist[histBucket(tt.want.last, 0)]++
+			}
 			if !reflect.DeepEqual(*es, tt.want) {
 				t.Errorf("eventStatistic.add() %s = %v, want %v", tt.name, *es, tt.want)
 			}
@@ -240,15 +243,15 @@ func Test_eventProperty_init(t *testing.T) {
 	t.Parallel()
 
 	type fields struct {
-		values [16]eventStatistic
+		values map[uint16]*eventStatistic
 	}
 	tests := []struct {
 		name   string
 		fields fields
 		want   eventStatistic
 	}{
-		{"init", fields{[16]eventStatistic{{start: 1.234, evFirst: true, evStart: true, count: 123, min: 44, max: 55}}},
-			eventStatistic{start: 1.234, evFirst: false, evStart: false, count: 0, min: math.MaxFloat64, max: 0}},
+		{"init", fields{map[uint16]*eventStatistic{0: {start: 1.234, evFirst: true, evStart: true, count: 123, min: 44, max: 55}}},
+			eventStatistic{start: 0, evFirst: false, evStart: false, count: 0, min: math.MaxFloat64, max: 0}},
 	}
 	for _, tt := range tests {
 		tt := tt
@@ -259,8 +262,11 @@ func Test_eventProperty_init(t *testing.T) {
 				values: tt.fields.values,
 			}
 			ep.init()
-			if !reflect.DeepEqual(ep.values[0], tt.want) {
-				t.Errorf("eventProperty.init() %s = %v, want %v", tt.name, ep.values[0], tt.want)
+			if len(ep.values) != 0 {
+				t.Errorf("eventProperty.init() %s = %d slots, want 0", tt.name, len(ep.values))
+			}
+			if got := ep.get(0); !reflect.DeepEqual(*got, tt.want) {
+				t.Errorf("eventProperty.init() %s = %v, want %v", tt.name, *got, tt.want)
 			}
 		})
 	}
@@ -270,7 +276,8 @@ func Test_eventProperty_add(t *testing.T) {
 	t.Parallel()
 
 	type fields struct {
-		values [16]eventStatistic
+		values  map[uint16]*eventStatistic
+		stopAll bool
 	}
 	type args struct {
 		time  float64
@@ -279,14 +286,18 @@ func Test_eventProperty_add(t *testing.T) {
 		text  string
 	}
 	tests := []struct {
-		name   string
-		fields fields
-		args   args
-		wantev bool
-		wantst float64
+		name    string
+		fields  fields
+		args    args
+		wantev  bool
+		wantst  float64
+		wantev3 bool
 	}{
-		{"add1", fields{}, args{47.11, 1, true, "text"}, true, 47.11},
-		{"addsStop", fields{}, args{47.12, 15, false, "text1"}, false, 0.0},
+		{"add1", fields{map[uint16]*eventStatistic{}, true}, args{47.11, 1, true, "text"}, true, 47.11, false},
+		{"addsStop", fields{map[uint16]*eventStatistic{}, true}, args{47.12, 15, false, "text1"}, false, 0.0, false},
+		{"addsStopAll", fields{map[uint16]*eventStatistic{3: {evStart: true, start: 1.0}}, true}, args{47.13, 15, false, "text2"}, false, 0.0, false},
+		{"addsStopX", fields{map[uint16]*eventStatistic{3: {evStart: true, start: 1.0}}, false}, args{47.14, 15, false, "text3"}, false, 0.0, true},
+		{"add1000", fields{map[uint16]*eventStatistic{}, false}, args{47.15, 1000, true, "text4"}, true, 47.15, false},
 	}
 	for _, tt := range tests {
 		tt := tt
@@ -294,16 +305,20 @@ func Test_eventProperty_add(t *testing.T) {
 			t.Parallel()
 
 			ep := &eventProperty{
-				values: tt.fields.values,
+				values:  tt.fields.values,
+				stopAll: tt.fields.stopAll,
 			}
-			ep.add(tt.args.time, tt.args.idx, tt.args.start, tt.args.text)
-			if ep.values[tt.args.idx].evStart != tt.wantev {
+			ep.add(tt.args.time, tt.args.idx, tt.args.start, tt.args.text, 0)
+			if ep.get(tt.args.idx).evStart != tt.wantev {
 				t.Errorf("eventProperty.add() %s = %v, want %v", tt.name,
-					ep.values[tt.args.idx].evStart, tt.wantev)
+					ep.get(tt.args.idx).evStart, tt.wantev)
 			}
-			if ep.values[tt.args.idx].start != tt.wantst {
+			if ep.get(tt.args.idx).start != tt.wantst {
 				t.Errorf("eventProperty.add() %s = %v, want %v", tt.name,
-					ep.values[tt.args.idx].start, tt.wantst)
+					ep.get(tt.args.idx).start, tt.wantst)
+			}
+			if es, ok := ep.values[3]; ok && es.evStart != tt.wantev3 {
+				t.Errorf("eventProperty.add() %s slot 3 = %v, want %v", tt.name, es.evStart, tt.wantev3)
 			}
 		})
 	}
@@ -313,7 +328,7 @@ func Test_eventProperty_getCount(t *testing.T) {
 	t.Parallel()
 
 	type fields struct {
-		values [16]eventStatistic
+		values map[uint16]*eventStatistic
 	}
 	type args struct {
 		idx uint16
@@ -324,9 +339,9 @@ func Test_eventProperty_getCount(t *testing.T) {
 		args   args
 		want   int
 	}{
-		{"test0", fields{[16]eventStatistic{{count: 1}, {count: 2}}}, args{0}, 1},
-		{"test1", fields{[16]eventStatistic{{count: 1}, {count: 2}}}, args{1}, 2},
-		{"test16", fields{[16]eventStatistic{0: {count: 1}, 15: {count: 2}}}, args{16}, 0},
+		{"test0", fields{map[uint16]*eventStatistic{0: {count: 1}, 1: {count: 2}}}, args{0}, 1},
+		{"test1", fields{map[uint16]*eventStatistic{0: {count: 1}, 1: {count: 2}}}, args{1}, 2},
+		{"test16", fields{map[uint16]*eventStatistic{0: {count: 1}, 15: {count: 2}}}, args{16}, 0},
 	}
 	for _, tt := range tests {
 		tt := tt
@@ -346,7 +361,7 @@ func Test_eventProperty_getAddCount(t *testing.T) {
 	t.Parallel()
 
 	type fields struct {
-		values [16]eventStatistic
+		values map[uint16]*eventStatistic
 	}
 	type args struct {
 		idx uint16
@@ -357,9 +372,9 @@ func Test_eventProperty_getAddCount(t *testing.T) {
 		args   args
 		want   string
 	}{
-		{"test0", fields{[16]eventStatistic{{evStart: false}, {evStart: true}}}, args{0}, "  "},
-		{"test1", fields{[16]eventStatistic{{evStart: true}, {evStart: true}}}, args{1}, "+1"},
-		{"test16", fields{[16]eventStatistic{0: {evStart: true}, 15: {evStart: true}}}, args{16}, "  "},
+		{"test0", fields{map[uint16]*eventStatistic{0: {evStart: false}, 1: {evStart: true}}}, args{0}, "  "},
+		{"test1", fields{map[uint16]*eventStatistic{0: {evStart: true}, 1: {evStart: true}}}, args{1}, "+1"},
+		{"test16", fields{map[uint16]*eventStatistic{0: {evStart: true}, 15: {evStart: true}}}, args{16}, "  "},
 	}
 	for _, tt := range tests {
 		tt := tt
@@ -414,7 +429,7 @@ func Test_eventProperty_getTot(t *testing.T) {
 	t.Parallel()
 
 	type fields struct {
-		values [16]eventStatistic
+		values map[uint16]*eventStatistic
 	}
 	type args struct {
 		idx uint16
@@ -425,7 +440,7 @@ func Test_eventProperty_getTot(t *testing.T) {
 		args   args
 		want   string
 	}{
-		{"test", fields{[16]eventStatistic{{tot: 1.234}}}, args{0}, "  1.23400s "},
+		{"test", fields{map[uint16]*eventStatistic{0: {tot: 1.234}}}, args{0}, "  1.23400s "},
 	}
 	for _, tt := range tests {
 		tt := tt
@@ -446,7 +461,7 @@ func Test_eventProperty_getMin(t *testing.T) {
 	t.Parallel()
 
 	type fields struct {
-		values [16]eventStatistic
+		values map[uint16]*eventStatistic
 	}
 	type args struct {
 		idx uint16
@@ -457,7 +472,7 @@ func Test_eventProperty_getMin(t *testing.T) {
 		args   args
 		want   string
 	}{
-		{"test", fields{[16]eventStatistic{{min: 1.234}}}, args{0}, "  1.23400s "},
+		{"test", fields{map[uint16]*eventStatistic{0: {min: 1.234}}}, args{0}, "  1.23400s "},
 	}
 	for _, tt := range tests {
 		tt := tt
@@ -478,7 +493,7 @@ func Test_eventProperty_getMax(t *testing.T) {
 	t.Parallel()
 
 	type fields struct {
-		values [16]eventStatistic
+		values map[uint16]*eventStatistic
 	}
 	type args struct {
 		idx uint16
@@ -489,7 +504,7 @@ func Test_eventProperty_getMax(t *testing.T) {
 		args   args
 		want   string
 	}{
-		{"test", fields{[16]eventStatistic{{max: 1.234}}}, args{0}, "  1.23400s "},
+		{"test", fields{map[uint16]*eventStatistic{0: {max: 1.234}}}, args{0}, "  1.23400s "},
 	}
 	for _, tt := range tests {
 		tt := tt
@@ -510,7 +525,7 @@ func Test_eventProperty_getAvg(t *testing.T) {
 	t.Parallel()
 
 	type fields struct {
-		values [16]eventStatistic
+		values map[uint16]*eventStatistic
 	}
 	type args struct {
 		idx uint16
@@ -521,7 +536,7 @@ func Test_eventProperty_getAvg(t *testing.T) {
 		args   args
 		want   string
 	}{
-		{"test", fields{[16]eventStatistic{{avg: 1.234}}}, args{0}, "  0.00000s "},
+		{"test", fields{map[uint16]*eventStatistic{0: {avg: 1.234}}}, args{0}, "  0.00000s "},
 	}
 	for _, tt := range tests {
 		tt := tt
@@ -542,7 +557,7 @@ func Test_eventProperty_getFirst(t *testing.T) {
 	t.Parallel()
 
 	type fields struct {
-		values [16]eventStatistic
+		values map[uint16]*eventStatistic
 	}
 	type args struct {
 		idx uint16
@@ -553,7 +568,7 @@ func Test_eventProperty_getFirst(t *testing.T) {
 		args   args
 		want   string
 	}{
-		{"test", fields{[16]eventStatistic{{first: 1.234}}}, args{0}, "  1.23400s "},
+		{"test", fields{map[uint16]*eventStatistic{0: {first: 1.234}}}, args{0}, "  1.23400s "},
 	}
 	for _, tt := range tests {
 		tt := tt
@@ -574,7 +589,7 @@ func Test_eventProperty_getLast(t *testing.T) {
 	t.Parallel()
 
 	type fields struct {
-		values [16]eventStatistic
+		values map[uint16]*eventStatistic
 	}
 	type args struct {
 		idx uint16
@@ -585,7 +600,7 @@ func Test_eventProperty_getLast(t *testing.T) {
 		args   args
 		want   string
 	}{
-		{"test", fields{[16]eventStatistic{{last: 1.234}}}, args{0}, "  1.23400s "},
+		{"test", fields{map[uint16]*eventStatistic{0: {last: 1.234}}}, args{0}, "  1.23400s "},
 	}
 	for _, tt := range tests {
 		tt := tt
@@ -616,7 +631,7 @@ func TestOutput_buildStatistic(t *testing.T) { //nolint:golint,paralleltest
 	var s7 = "../../testdata/test7.binary"
 
 	type fields struct {
-		evProps       [4]eventProperty
+		evProps       map[uint16]*eventProperty
 		columns       []string
 		componentSize int
 		propertySize  int
@@ -635,12 +650,12 @@ func TestOutput_buildStatistic(t *testing.T) { //nolint:golint,paralleltest
 		want2  int
 		want3  float64
 	}{
-		{"test1", fields{[4]eventProperty{}, []string{"Index", "Time (s)", "Component", "Event Property", "Value"}, 0, 0}, args{s1, eds0, tds}, 0, 9, 14, 0.0},
-		{"test3", fields{[4]eventProperty{}, []string{"Index", "Time (s)", "Component", "Event Property", "Value"}, 0, 0}, args{s3, eds0, tds}, 1, 9, 14, 0.0},
-		{"test4", fields{[4]eventProperty{}, []string{"Index", "Time (s)", "Component", "Event Property", "Value"}, 0, 0}, args{s4, eds0, tds}, 1, 9, 14, 0.5},
-		{"test6", fields{[4]eventProperty{}, []string{"Index", "Time (s)", "Component", "Event Property", "Value"}, 0, 0}, args{s6, eds0, tds}, 1, 9, 14, 0.25},
-		{"test7a", fields{[4]eventProperty{}, []string{"Index", "Time (s)", "Component", "Event Property", "Value"}, 0, 0}, args{s7, eds0, tds}, 1, 9, 14, 0.25},
-		{"test7b", fields{[4]eventProperty{}, []string{"Index", "Time (s)", "Component", "Event Property", "Value"}, 0, 0}, args{s7, eds, tds}, 1, 15, 24, 0.25},
+		{"test1", fields{nil, []string{"Index", "Time (s)", "Component", "Event Property", "Value"}, 0, 0}, args{s1, eds0, tds}, 0, 9, 14, 0.0},
+		{"test3", fields{nil, []string{"Index", "Time (s)", "Component", "Event Property", "Value"}, 0, 0}, args{s3, eds0, tds}, 1, 9, 14, 0.0},
+		{"test4", fields{nil, []string{"Index", "Time (s)", "Component", "Event Property", "Value"}, 0, 0}, args{s4, eds0, tds}, 1, 9, 14, 0.5},
+		{"test6", fields{nil, []string{"Index", "Time (s)", "Component", "Event Property", "Value"}, 0, 0}, args{s6, eds0, tds}, 1, 9, 14, 0.25},
+		{"test7a", fields{nil, []string{"Index", "Time (s)", "Component", "Event Property", "Value"}, 0, 0}, args{s7, eds0, tds}, 1, 9, 14, 0.25},
+		{"test7b", fields{nil, []string{"Index", "Time (s)", "Component", "Event Property", "Value"}, 0, 0}, args{s7, eds, tds}, 1, 15, 24, 0.25},
 	}
 	for _, tt := range tests { //nolint:golint,paralleltest
 		t.Run(tt.name, func(t *testing.T) {
@@ -667,11 +682,254 @@ func TestOutput_buildStatistic(t *testing.T) { //nolint:golint,paralleltest
 	}
 }
 
+func TestOutput_buildStatisticX(t *testing.T) { //nolint:golint,paralleltest
+	var s17 = "../../testdata/test17.binary"
+
+	o := &Output{
+		columns: []string{"Index", "Time (s)", "Component", "Event Property", "Value"},
+	}
+	TimeFactor = nil
+	var b event.Binary
+	in := b.Open(&s17)
+	if got := o.buildStatistic(in, map[uint16]scvd.Event{}, nil); got != 8 {
+		t.Errorf("Output.buildStatistic() = %v, want %v", got, 8)
+	}
+	b.Close()
+	ep, ok := o.evProps[groupX]
+	if !ok {
+		t.Fatalf("Output.buildStatistic() no extended statistics")
+	}
+	tests := []struct {
+		idx  uint16
+		name string
+		tot  float64
+	}{
+		{1, "9c1e503c", 100e-6},
+		{2, "9c1e503f", 250e-6},
+	}
+	for _, tt := range tests {
+		es, ok := ep.values[tt.idx]
+		if !ok {
+			t.Errorf("Output.buildStatistic() X(%d) missing", tt.idx)
+			continue
+		}
+		if es.count != 1 || es.name != tt.name || math.Abs(es.tot-tt.tot) > 1e-12 {
+			t.Errorf("Output.buildStatistic() X(%d) = %d %s %v, want 1 %s %v", tt.idx, es.count, es.name, es.tot, tt.name, tt.tot)
+		}
+	}
+}
+
+func TestOutput_buildStatisticTarget(t *testing.T) { //nolint:golint,paralleltest
+	var s18 = "../../testdata/test18.binary"
+
+	o := &Output{
+		columns: []string{"Index", "Time (s)", "Component", "Event Property", "Value"},
+	}
+	TimeFactor = nil
+	var b event.Binary
+	in := b.Open(&s18)
+	if got := o.buildStatistic(in, map[uint16]scvd.Event{}, nil); got != 4 {
+		t.Errorf("Output.buildStatistic() = %v, want %v", got, 4)
+	}
+	b.Close()
+	ep, ok := o.evProps[0]
+	if !ok {
+		t.Fatalf("Output.buildStatistic() no statistics of group A")
+	}
+	es, ok := ep.values[1]
+	if !ok {
+		t.Fatalf("Output.buildStatistic() A(1) missing")
+	}
+	var hist [histBuckets]int
+	hist[4] = 100  // 10 ticks
+	hist[10] = 100 // 1000 ticks
+	if !es.target || !es.evFirst || es.count != 200 || es.hist != hist {
+		t.Errorf("Output.buildStatistic() A(1) = %v %v %d %v, want true true 200 %v", es.target, es.evFirst, es.count, es.hist, hist)
+	}
+	if math.Abs(es.min-10e-6) > 1e-12 || math.Abs(es.max-1000e-6) > 1e-12 || math.Abs(es.tot-101e-3) > 1e-12 {
+		t.Errorf("Output.buildStatistic() A(1) min/max/tot = %v %v %v, want 10e-6 1000e-6 101e-3", es.min, es.max, es.tot)
+	}
+}
+
+func TestOutput_buildStatisticEnergy(t *testing.T) { //nolint:golint,paralleltest
+	var s19 = "../../testdata/test19.binary"
+
+	o := &Output{
+		columns: []string{"Index", "Time (s)", "Component", "Event Property", "Value"},
+	}
+	TimeFactor = nil
+	var b event.Binary
+	in := b.Open(&s19)
+	if got := o.buildStatistic(in, map[uint16]scvd.Event{}, nil); got != 406 {
+		t.Errorf("Output.buildStatistic() = %v, want %v", got, 406)
+	}
+	b.Close()
+	ep, ok := o.evProps[0]
+	if !ok {
+		t.Fatalf("Output.buildStatistic() no statistics of group A")
+	}
+	// simulated power source: A(1) 10mW for 1ms, A(2) 2mW at start and 4mW at stop for 500us (100 times each)
+	tests := []struct {
+		slot   uint16
+		energy float64
+		power  float64
+	}{
+		{1, 1e-3, 10e-3},
+		{2, 150e-6, 3e-3},
+	}
+	for _, tt := range tests {
+		es, ok := ep.values[tt.slot]
+		if !ok {
+			t.Fatalf("Output.buildStatistic() A(%d) missing", tt.slot)
+		}
+		if es.target || !es.hasEnergy || es.count != 100 {
+			t.Errorf("Output.buildStatistic() A(%d) = %v %v %d, want false true 100", tt.slot, es.target, es.hasEnergy, es.count)
+		}
+		if math.Abs(es.energy-tt.energy) > 1e-12 || math.Abs(es.getPower()-tt.power) > 1e-9 {
+			t.Errorf("Output.buildStatistic() A(%d) energy/power = %v %v, want %v %v", tt.slot, es.energy, es.getPower(), tt.energy, tt.power)
+		}
+	}
+}
+
+func TestOutput_buildStatisticDuration(t *testing.T) { //nolint:golint,paralleltest
+	var s23 = "../../testdata/test23.binary"
+
+	o := &Output{
+		columns: []string{"Index", "Time (s)", "Component", "Event Property", "Value"},
+	}
+	TimeFactor = nil
+	var b event.Binary
+	in := b.Open(&s23)
+	if got := o.buildStatistic(in, map[uint16]scvd.Event{}, nil); got != 32 {
+		t.Errorf("Output.buildStatistic() = %v, want %v", got, 32)
+	}
+	b.Close()
+	// 1MHz timer, 10 iterations: A(1) for 10*i us, B(2) 250us and B(3) 200us stopped by B(15)
+	tests := []struct {
+		group uint16
+		idx   uint16
+		count int
+		tot   float64
+		min   float64
+		max   float64
+		start float64
+	}{
+		{0, 1, 10, 550e-6, 10e-6, 100e-6, 4600e-6},
+		{1, 2, 10, 2500e-6, 250e-6, 250e-6, 210e-6},
+		{1, 3, 10, 2000e-6, 200e-6, 200e-6, 260e-6},
+	}
+	for _, tt := range tests {
+		es := o.property(tt.group).get(tt.idx)
+		if es.count != tt.count || math.Abs(es.tot-tt.tot) > 1e-12 || math.Abs(es.min-tt.min) > 1e-12 ||
+			math.Abs(es.max-tt.max) > 1e-12 || math.Abs(es.maxTime-tt.start) > 1e-12 {
+			t.Errorf("Output.buildStatistic() %d(%d) = %v, want %v", tt.group, tt.idx, *es, tt)
+		}
+	}
+	if _, ok := o.property(1).values[15]; ok {
+		t.Errorf("Output.buildStatistic() B(15) counted")
+	}
+}
+
+func TestOutput_buildStatisticThread(t *testing.T) { //nolint:golint,paralleltest
+	var s20 = "../../testdata/test20.binary"
+
+	o := &Output{
+		columns: []string{"Index", "Time (s)", "Component", "Event Property", "Value"},
+	}
+	TimeFactor = nil
+	var b event.Binary
+	in := b.Open(&s20)
+	if got := o.buildStatistic(in, map[uint16]scvd.Event{}, nil); got != 34 {
+		t.Errorf("Output.buildStatistic() = %v, want %v", got, 34)
+	}
+	b.Close()
+	if o.threadSize != len("20001000") {
+		t.Errorf("Output.buildStatistic() threadSize = %v, want %v", o.threadSize, len("20001000"))
+	}
+	// thread 1 registered on creation, thread 2 registered by its first event
+	wantThreads := map[uint8]string{1: "20001100", 2: "20001000"}
+	if !reflect.DeepEqual(o.threads, wantThreads) {
+		t.Errorf("Output.buildStatistic() threads = %v, want %v", o.threads, wantThreads)
+	}
+	ep, ok := o.evProps[0]
+	if !ok {
+		t.Fatalf("Output.buildStatistic() no statistics of group A")
+	}
+	es, ok := ep.values[1]
+	if !ok {
+		t.Fatalf("Output.buildStatistic() A(1) missing")
+	}
+	if es.count != 8 {
+		t.Errorf("Output.buildStatistic() A(1) count = %v, want %v", es.count, 8)
+	}
+	want := []ThreadStatistic{
+		{Thread: "20001100", Count: 4, Total: "1.20000ms", Avg: "300.00000µs"},
+		{Thread: "20001000", Count: 4, Total: "400.00000µs", Avg: "100.00000µs"},
+	}
+	if got := o.getThreads(es); !reflect.DeepEqual(got, want) {
+		t.Errorf("Output.getThreads() = %v, want %v", got, want)
+	}
+	names := []struct {
+		info event.Info
+		want string
+	}{
+		{event.Info{ID: 0x0A00}, "-"},
+		{event.Info{ID: 0x0A01, Thread: 2}, "20001000"},
+		{event.Info{ID: 0x0A01, Thread: 5}, "#5"},
+	}
+	for _, tt := range names {
+		if got := o.threadName(&tt.info); got != tt.want {
+			t.Errorf("Output.threadName(%v) = %v, want %v", tt.info, got, tt.want)
+		}
+	}
+}
+
+func Test_histBucket(t *testing.T) { //nolint:golint,paralleltest
+	TimeFactor = new(float64)
+	*TimeFactor = 1.0
+	defer func() { TimeFactor = nil }()
+
+	tests := []struct {
+		diff float64
+		base int
+		want int
+	}{
+		{0, 0, 0},
+		{1, 0, 1},
+		{3, 0, 2},
+		{4, 0, 3},
+		{1000, 0, 10},
+		{1000, 8, 2},
+		{255, 8, 0},
+		{1 << 20, 0, 15},
+	}
+	for _, tt := range tests {
+		if got := histBucket(tt.diff, tt.base); got != tt.want {
+			t.Errorf("histBucket(%v, %d) = %d, want %d", tt.diff, tt.base, got, tt.want)
+		}
+	}
+}
+
+func Test_formatHistogram(t *testing.T) { //nolint:golint,paralleltest
+	TimeFactor = new(float64)
+	*TimeFactor = 1e-6
+	defer func() { TimeFactor = nil }()
+
+	es := eventStatistic{histBase: 2}
+	es.hist[0] = 3
+	es.hist[3] = 5
+	es.hist[histBuckets-1] = 1
+	want := "<4.00000µs: 3, <32.00000µs: 5, >=65.53600ms: 1"
+	if got := formatHistogram(es.getHistogram()); got != want {
+		t.Errorf("formatHistogram() = %q, want %q", got, want)
+	}
+}
+
 func TestOutput_printStatistic(t *testing.T) { //nolint:golint,paralleltest
 	var b bytes.Buffer
 
-	props0 := [4]eventProperty{}
-	props1 := [4]eventProperty{{[16]eventStatistic{{evFirst: true, count: 1, tot: 2, min: 3, max: 4, avg: 5, first: 6, last: 7}}}}
+	props0 := map[uint16]*eventProperty{}
+	props1 := map[uint16]*eventProperty{0: {values: map[uint16]*eventStatistic{0: {evFirst: true, count: 1, tot: 2, min: 3, max: 4, avg: 5, first: 6, last: 7}}}}
 
 	header := "   Start/Stop event statistic\n" +
 		"   --------------------------\n\n" +
@@ -682,8 +940,14 @@ func TestOutput_printStatistic(t *testing.T) { //nolint:golint,paralleltest
 		"      Min: Start: 0.00000000  Stop: 3.00000000 \n" +
 		"      Max: Start: 0.00000000  Stop: 4.00000000 \n\n"
 
+	propsX := map[uint16]*eventProperty{groupX: {values: map[uint16]*eventStatistic{1000: {evFirst: true, count: 1, tot: 2, min: 3, max: 4, avg: 5, first: 6, last: 7, name: "rx"}}}}
+	lineX := "X(1000)     1     2.00000s    3.00000s    4.00000s    5.00000s    6.00000s    7.00000s \n" +
+		"      Name: rx\n" +
+		"      Min: Start: 0.00000000  Stop: 3.00000000 \n" +
+		"      Max: Start: 0.00000000  Stop: 4.00000000 \n\n"
+
 	type fields struct {
-		evProps       [4]eventProperty
+		evProps       map[uint16]*eventProperty
 		componentSize int
 		propertySize  int
 	}
@@ -700,6 +964,7 @@ func TestOutput_printStatistic(t *testing.T) { //nolint:golint,paralleltest
 	}{
 		{"header", fields{props0, 15, 20}, args{nil, 1}, header, false},
 		{"line1", fields{props1, 15, 20}, args{nil, 1}, header + line1, false},
+		{"lineX", fields{propsX, 15, 20}, args{nil, 1}, header + lineX, false},
 	}
 	eventsTable := EventsTable{
 		Events:     []EventRecord{},
@@ -774,6 +1039,7 @@ func TestOutput_printEvents(t *testing.T) { //nolint:golint,paralleltest
 	var s1 = "../../testdata/test1.binary"
 	var s10 = "../../testdata/test10.binary"
 	var s11 = "../../testdata/test11.binary"
+	var s15 = "../../testdata/test15.binary"
 	var sNix = "../../testdata/xxxx"
 
 	line1 := "    0 0.00000124 0xFF     0xFF03       val1=0x00000004, val2=0x00000002\n" +
@@ -782,9 +1048,11 @@ func TestOutput_printEvents(t *testing.T) { //nolint:golint,paralleltest
 		"    1 0.00000124 briefbriefbrief propertypropertyproperty \"hello wo\"\n"
 	line3 := "    0 0.00000124 0xFF     0xFF00       val1=0x00000004, val2=0x00000002\n" +
 		"    1 0.00000124 0xFE     0xFE00       \"hello wo\"\n"
+	line4 := "    0 0.00000124 0x10     0x1001       data=0x68656c6c6f20776f726c64\n" +
+		"    1 0.00000248 0x10     0x1002       incomplete transfer (2 of 4 bytes): data=0x61620000\n"
 
 	type fields struct {
-		evProps       [4]eventProperty
+		evProps       map[uint16]*eventProperty
 		columns       []string
 		componentSize int
 		propertySize  int
@@ -808,6 +1076,7 @@ func TestOutput_printEvents(t *testing.T) { //nolint:golint,paralleltest
 		{"read1", fields{}, args{}, &s10, line1, false},
 		{"read2", fields{}, args{evdefs: eds}, &s10, line2, false},
 		{"read3", fields{}, args{}, &s11, line3, false},
+		{"read4", fields{}, args{}, &s15, line4, false},
 		{"readNix", fields{}, args{}, &sNix, "", false},
 	}
 	eventsTable := EventsTable{
@@ -842,11 +1111,102 @@ func TestOutput_printEvents(t *testing.T) { //nolint:golint,paralleltest
 	}
 }
 
+func TestOutput_printEvents_repeat(t *testing.T) { //nolint:golint,paralleltest
+	// EventRecord2 events in the log format: type 2, length 20, timestamp, info (ID), val1, val2
+	var log []uint8
+	for _, ev := range [][4]uint32{
+		{10, 0x0A01, 1, 2}, {20, 0x0A02, 3, 4},
+		{50, idRepeat, 1000, 0x0A01}, // 0x0A01 repeated 1000 times, last at 50
+		{60, idRepeat, 5, 0x0B00},    // unknown repeated event
+	} {
+		log = append(log, profileData(2|20<<16, ev[0], 0, ev[1], ev[2], ev[3])...)
+	}
+	tf := 1e-6
+	TimeFactor = &tf
+	FormatType = "txt"
+	defer func() { TimeFactor = nil }()
+
+	var b bytes.Buffer
+	out := bufio.NewWriter(&b)
+	o := &Output{columns: []string{"Index", "Time (s)", "Component", "Event Property", "Value"},
+		componentSize: 9, propertySize: 14}
+	eventsTable := EventsTable{}
+	if err := o.printEvents(out, bufio.NewReader(bytes.NewReader(log)), nil, nil, &eventsTable); err != nil {
+		t.Fatalf("Output.printEvents() error = %v", err)
+	}
+	out.Flush()
+	if len(eventsTable.Events) != 4 {
+		t.Fatalf("Output.printEvents() %d events, want 4", len(eventsTable.Events))
+	}
+	if ev := eventsTable.Events[2]; ev.EventProperty != "0x0A01" || math.Abs(ev.Time-50e-6) > 1e-12 ||
+		ev.Value != "×1000 val1=0x00000001, val2=0x00000002" {
+		t.Errorf("Output.printEvents() repeat = %v", ev)
+	}
+	if ev := eventsTable.Events[3]; ev.EventProperty != "0xFF15" || ev.Value != "val1=0x00000005, val2=0x00000b00" {
+		t.Errorf("Output.printEvents() unknown repeat = %v", ev)
+	}
+	if !strings.Contains(b.String(), "    2 0.00005000 0x0A      0x0A01         ×1000 val1=0x00000001") {
+		t.Errorf("Output.printEvents() = %q", b.String())
+	}
+}
+
+func TestOutput_printEvents_repeatBreak(t *testing.T) { //nolint:golint,paralleltest
+	// A sequence of repeats ends with the next event of the context, also with EventRecorderStart and stdout:
+	// the Repeat event is recorded before that event and shown in place
+	var log []uint8
+	for _, ev := range [][4]uint32{
+		{10, 0x0A01, 1, 2},
+		{30, idRepeat, 3, 0x0A01}, // 0x0A01 repeated 3 times, last at 30
+		{40, 0xFF01, 0, 0},        // EventRecorderStart
+		{50, 0x0A01, 1, 2},
+		{60, idRepeat, 2, 0x0A01}, // 0x0A01 repeated 2 times, last at 60
+	} {
+		log = append(log, profileData(2|20<<16, ev[0], 0, ev[1], ev[2], ev[3])...)
+	}
+	log = append(log, profileData(1|16<<16, 70, 0, 0xFE00|4<<16, 0x0A216968)...) // stdout "hi!\n"
+	tf := 1e-6
+	TimeFactor = &tf
+	FormatType = "txt"
+	defer func() { TimeFactor = nil }()
+
+	var b bytes.Buffer
+	out := bufio.NewWriter(&b)
+	o := &Output{columns: []string{"Index", "Time (s)", "Component", "Event Property", "Value"},
+		componentSize: 9, propertySize: 14}
+	eventsTable := EventsTable{}
+	if err := o.printEvents(out, bufio.NewReader(bytes.NewReader(log)), nil, nil, &eventsTable); err != nil {
+		t.Fatalf("Output.printEvents() error = %v", err)
+	}
+	out.Flush()
+	want := []struct {
+		property string
+		time     float64
+		repeat   bool
+	}{
+		{"0x0A01", 10e-6, false}, {"0x0A01", 30e-6, true}, {"0xFF01", 40e-6, false},
+		{"0x0A01", 50e-6, false}, {"0x0A01", 60e-6, true}, {"0xFE00", 70e-6, false},
+	}
+	if len(eventsTable.Events) != len(want) {
+		t.Fatalf("Output.printEvents() %d events, want %d", len(eventsTable.Events), len(want))
+	}
+	for i, w := range want {
+		ev := eventsTable.Events[i]
+		if ev.EventProperty != w.property || math.Abs(ev.Time-w.time) > 1e-12 ||
+			strings.HasPrefix(ev.Value, "×") != w.repeat {
+			t.Errorf("Output.printEvents() event %d = %v", i, ev)
+		}
+	}
+	if !strings.Contains(b.String(), "    1 0.00003000 0x0A      0x0A01         ×3 val1=0x00000001") ||
+		!strings.Contains(b.String(), "    4 0.00006000 0x0A      0x0A01         ×2 val1=0x00000001") {
+		t.Errorf("Output.printEvents() = %q", b.String())
+	}
+}
+
 func TestOutput_printHeader(t *testing.T) { //nolint:golint,paralleltest
 	var b bytes.Buffer
 
 	type fields struct {
-		evProps       [4]eventProperty
+		evProps       map[uint16]*eventProperty
 		columns       []string
 		componentSize int
 		propertySize  int
@@ -935,7 +1295,7 @@ func TestOutput_print(t *testing.T) { //nolint:golint,paralleltest
 		"    1 7.75000000 0xFE      0xFE00         \"hello wo\"\n"
 
 	type fields struct {
-		evProps       [4]eventProperty
+		evProps       map[uint16]*eventProperty
 		columns       []string
 		componentSize int
 		propertySize  int
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package output
+
+import (
+	"bufio"
+	"encoding/binary"
+	"fmt"
+	"strings"
+)
+
+// snapshot of the recorder self-profiling counters (component 0xFF)
+const (
+	idProfile     = 0xFF14 // data: events, time_lo, time_hi, retries[4], irq_masked, rate_max
+	profileLength = 36
+)
+
+// labels of the lock retry buckets
+var profileRetryLabels = [4]string{"0", "1", "2-3", "4-6"}
+
+// last snapshot of the recorder self-profiling counters
+type recorderProfile struct {
+	valid     bool
+	events    uint32
+	tot       float64 // time in record functions
+	retries   [4]uint32
+	irqMasked float64 // maximum time with masked interrupts
+	rateMax   uint32  // maximum number of events within 1 ms
+	first     float64 // time of first event
+	last      float64 // time of snapshot
+}
+
+func (rp *recorderProfile) init() {
+	*rp = recorderProfile{}
+}
+
+// set the counters from a snapshot recorded by the target, time is the time of the snapshot
+func (rp *recorderProfile) set(time float64, data []uint8) {
+	if len(data) < profileLength {
+		return
+	}
+	rp.valid = true
+	rp.events = binary.LittleEndian.Uint32(data[0:])
+	rp.tot = TimeInSecs(uint64(binary.LittleEndian.Uint32(data[8:]))<<32 | uint64(binary.LittleEndian.Uint32(data[4:])))
+	for k := range rp.retries {
+		rp.retries[k] = binary.LittleEndian.Uint32(data[12+4*k:])
+	}
+	rp.irqMasked = TimeInSecs(uint64(binary.LittleEndian.Uint32(data[28:])))
+	rp.rateMax = binary.LittleEndian.Uint32(data[32:])
+	rp.last = time
+}
+
+// get the load (percentage of time spent in record functions)
+func (rp *recorderProfile) getLoad() float64 {
+	if rp.last <= rp.first {
+		return 0
+	}
+	return 100 * rp.tot / (rp.last - rp.first)
+}
+
+type RecorderProfile struct {
+	Events    uint32   `json:"events" xml:"events"`
+	Total     string   `json:"total" xml:"total"`
+	Avg       string   `json:"avg" xml:"avg"`
+	Load      float64  `json:"load" xml:"load"` // percentage of time
+	Retries   []uint32 `json:"retries" xml:"retries"`
+	IrqMasked string   `json:"irqMasked" xml:"irqMasked"`
+	PeakRate  uint32   `json:"peakRate" xml:"peakRate"` // events per ms
+}
+
+func (rp *recorderProfile) statistics() *RecorderProfile {
+	if !rp.valid {
+		return nil
+	}
+	var avg float64
+	if rp.events != 0 {
+		avg = rp.tot / float64(rp.events)
+	}
+	return &RecorderProfile{
+		Events:    rp.events,
+		Total:     convertUnit(rp.tot, "s"),
+		Avg:       convertUnit(avg, "s"),
+		Load:      rp.getLoad(),
+		Retries:   rp.retries[:],
+		IrqMasked: convertUnit(rp.irqMasked, "s"),
+		PeakRate:  rp.rateMax,
+	}
+}
+
+func (rp *recorderProfile) print(out *bufio.Writer, eventTable *EventsTable) error {
+	eventTable.Profile = rp.statistics()
+	if eventTable.Profile == nil {
+		return nil
+	}
+	p := eventTable.Profile
+	if len(eventTable.Statistics) == 0 && len(eventTable.Interrupts) == 0 {
+		if err := conditionalWrite(out, "\n"); err != nil {
+			return err
+		}
+	}
+	if err := conditionalWrite(out, "   Recorder profile\n"); err != nil {
+		return err
+	}
+	if err := conditionalWrite(out, "   ----------------\n\n"); err != nil {
+		return err
+	}
+	err := conditionalWrite(out, "Events: %d  total: %s  avg: %s  load: %.2f%%\n",
+		p.Events, strings.TrimSpace(p.Total), strings.TrimSpace(p.Avg), p.Load)
+	if err != nil {
+		return err
+	}
+	items := make([]string, 0, len(p.Retries))
+	for k, n := range p.Retries {
+		items = append(items, fmt.Sprintf("%s: %d", profileRetryLabels[k], n))
+	}
+	if err = conditionalWrite(out, "Lock retries: %s\n", strings.Join(items, ", ")); err != nil {
+		return err
+	}
+	if err = conditionalWrite(out, "Max IRQ masked: %s\n", strings.TrimSpace(p.IrqMasked)); err != nil {
+		return err
+	}
+	if err = conditionalWrite(out, "Peak event rate: %d events/ms\n", p.PeakRate); err != nil {
+		return err
+	}
+	return conditionalWrite(out, "\n")
+}
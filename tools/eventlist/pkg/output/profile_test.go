@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package output
+
+import (
+	"bufio"
+	"bytes"
+	"encoding/binary"
+	"math"
+	"strings"
+	"testing"
+)
+
+func profileData(vals ...uint32) []uint8 {
+	data := make([]uint8, 4*len(vals))
+	for k, v := range vals {
+		binary.LittleEndian.PutUint32(data[4*k:], v)
+	}
+	return data
+}
+
+func Test_recorderProfile(t *testing.T) { //nolint:golint,paralleltest
+	var rp recorderProfile
+	tf := 1e-6
+	TimeFactor = &tf
+	FormatType = "txt"
+	defer func() { TimeFactor = nil }()
+
+	rp.init()
+	rp.first = 1
+	if rp.statistics() != nil {
+		t.Errorf("recorderProfile.statistics() without snapshot != nil")
+	}
+	rp.set(2, profileData(1, 2, 3)) // too short
+	if rp.valid {
+		t.Errorf("recorderProfile.set() with %d bytes valid", 12)
+	}
+	// 1000 events, 0x1_00000010 ticks, retries, 7 ticks masked, 42 events/ms
+	rp.set(3, profileData(1000, 0x10, 1, 990, 8, 1, 1, 7, 42))
+	if !rp.valid || rp.events != 1000 || rp.retries != [4]uint32{990, 8, 1, 1} || rp.rateMax != 42 {
+		t.Errorf("recorderProfile.set() = %v", rp)
+	}
+	if math.Abs(rp.tot-float64(0x100000010)*tf) > 1e-9 || math.Abs(rp.irqMasked-7e-6) > 1e-12 {
+		t.Errorf("recorderProfile.set() tot = %v, irqMasked = %v", rp.tot, rp.irqMasked)
+	}
+	if load := rp.getLoad(); math.Abs(load-100*rp.tot/2) > 1e-9 {
+		t.Errorf("recorderProfile.getLoad() = %v, want %v", load, 100*rp.tot/2)
+	}
+
+	var buf bytes.Buffer
+	out := bufio.NewWriter(&buf)
+	eventTable := EventsTable{}
+	if err := rp.print(out, &eventTable); err != nil {
+		t.Fatalf("recorderProfile.print() error = %v", err)
+	}
+	out.Flush()
+	if eventTable.Profile == nil || eventTable.Profile.Events != 1000 || eventTable.Profile.PeakRate != 42 {
+		t.Errorf("recorderProfile.print() Profile = %v", eventTable.Profile)
+	}
+	for _, want := range []string{"Recorder profile", "Lock retries: 0: 990, 1: 8, 2-3: 1, 4-6: 1",
+		"Max IRQ masked: 7.00000µs", "Peak event rate: 42 events/ms"} {
+		if !strings.Contains(buf.String(), want) {
+			t.Errorf("recorderProfile.print() = %q, missing %q", buf.String(), want)
+		}
+	}
+}
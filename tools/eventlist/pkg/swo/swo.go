@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Package swo decodes event records streamed by the Event Recorder through ITM
+// stimulus ports from a captured SWO byte stream into the log format written by
+// the Event Recorder with semihosting.
+package swo
+
+import (
+	"encoding/binary"
+	"errors"
+	"eventlist/pkg/dump"
+	"fmt"
+	"io"
+)
+
+var ErrPort = errors.New("invalid ITM stimulus port")
+
+// ITM packet headers
+const (
+	headerOverflow = 0x70 // overflow packet
+	headerGTS1     = 0x94 // global timestamp 1
+	headerGTS2     = 0xB4 // global timestamp 2
+	sizeMask       = 0x03 // source packet: payload size 1, 2 or 4 bytes
+	hardwareSource = 0x04 // source packet: hardware source (DWT)
+	portPos        = 3    // source packet: port number
+	continuation   = 0x80 // continuation bit of timestamp and extension packets
+)
+
+// Event record information bits streamed with the first word of a record
+const (
+	recordValid  = 0x08000000
+	recordLocked = 0x04000000
+)
+
+// MaxPort is the highest stimulus port for the first word of a record (port+1 holds the values)
+const MaxPort = 30
+
+// Result of decoding a SWO byte stream
+type Result struct {
+	Events    int // number of decoded events
+	Discarded int // number of records discarded (lost by overflow or incomplete)
+	Overflows int // number of ITM overflow packets
+}
+
+type decoder struct {
+	recs   *dump.Records
+	port   uint8
+	acc    [2][]uint8 // bytes of incomplete words of port and port+1
+	words  []uint32   // words of current record: info, ts, val1, val2
+	lost   bool       // values of a lost record are skipped
+	result Result
+}
+
+// discard the current record
+func (d *decoder) discard() {
+	if len(d.words) != 0 {
+		d.recs.Discard()
+		d.words = d.words[:0]
+	}
+}
+
+// add a word written to port (first word of a record) or port+1 (timestamp and values)
+func (d *decoder) word(n int, w uint32) error {
+	if n == 0 {
+		d.discard()
+		d.lost = false
+		if w&(recordValid|recordLocked) != recordValid { // not a record information
+			d.recs.Discard()
+			d.lost = true
+			return nil
+		}
+		d.words = append(d.words, w)
+		return nil
+	}
+	if len(d.words) == 0 {
+		if !d.lost { // first word of the record is lost
+			d.recs.Discard()
+			d.lost = true
+		}
+		return nil
+	}
+	d.words = append(d.words, w)
+	if len(d.words) < 4 {
+		return nil
+	}
+	err := d.recs.Add(d.words[1], d.words[2], d.words[3], d.words[0]&^recordValid)
+	d.words = d.words[:0]
+	return err
+}
+
+// add the payload of a software source packet
+func (d *decoder) source(port uint8, payload []uint8) error {
+	if port != d.port && port != d.port+1 {
+		return nil
+	}
+	n := int(port - d.port)
+	d.acc[n] = append(d.acc[n], payload...)
+	for len(d.acc[n]) >= 4 {
+		if err := d.word(n, binary.LittleEndian.Uint32(d.acc[n])); err != nil {
+			return err
+		}
+		d.acc[n] = d.acc[n][4:]
+	}
+	return nil
+}
+
+// skip the payload of a packet with continuation bits, returns the index of the next packet
+func skipContinuation(data []uint8, i int) int {
+	for i < len(data) && data[i]&continuation != 0 {
+		i++
+	}
+	return i + 1
+}
+
+// Decode parses the ITM packets (synchronization, overflow, timestamp, extension, hardware and
+// software source packets) of a SWO byte stream and writes the events recorded on the stimulus
+// ports port and port+1 in the log format to out
+func Decode(in io.Reader, out io.Writer, port int) (Result, error) {
+	if port < 0 || port > MaxPort {
+		return Result{}, fmt.Errorf("%w: %d", ErrPort, port)
+	}
+	data, err := io.ReadAll(in)
+	if err != nil {
+		return Result{}, err
+	}
+	d := decoder{recs: dump.NewRecords(out), port: uint8(port)}
+
+	for i := 0; i < len(data); {
+		header := data[i]
+		i++
+		switch {
+		case header == 0x00: // synchronization packet: zeros followed by 0x80
+			for i < len(data) && data[i] == 0x00 {
+				i++
+			}
+			if i < len(data) && data[i] == 0x80 {
+				i++
+			}
+		case header == headerOverflow: // data of stimulus ports is lost
+			d.result.Overflows++
+			d.discard()
+			d.acc[0], d.acc[1] = nil, nil
+		case header&0x0F == 0x00: // local timestamp
+			if header&continuation != 0 {
+				i = skipContinuation(data, i)
+			}
+		case header == headerGTS1 || header == headerGTS2: // global timestamp
+			i = skipContinuation(data, i)
+		case header&0x0B == 0x08: // extension
+			if header&continuation != 0 {
+				i = skipContinuation(data, i)
+			}
+		case header&sizeMask != 0: // source packet
+			size := 1 << ((header & sizeMask) - 1)
+			if i+size > len(data) { // truncated capture
+				i = len(data)
+				break
+			}
+			if header&hardwareSource == 0 {
+				if err = d.source(header>>portPos, data[i:i+size]); err != nil {
+					return d.result, err
+				}
+			}
+			i += size
+		default: // reserved header
+		}
+	}
+
+	d.discard()
+	res, err := d.recs.Close()
+	d.result.Events = res.Events
+	d.result.Discarded = res.Discarded
+	return d.result, err
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package swo
+
+import (
+	"bufio"
+	"bytes"
+	"errors"
+	"eventlist/pkg/event"
+	"os"
+	"testing"
+)
+
+// test24.swo: SWO capture of the records of test22.dump streamed on the stimulus ports 8 and 9:
+// EventRecord2, EventRecord4 and EventRecordData with 3, 20 and 0 bytes (8 records per iteration)
+// interleaved with synchronization, timestamp, extension, hardware source
+// packets and characters on stimulus port 0
+var s24 = "../../testdata/test24.swo"
+
+// index of the source packet of the first word of record i in test24.swo
+func recordIndex(t *testing.T, data []uint8, i int) int {
+	t.Helper()
+	for k := 0; k < len(data)-4; k++ {
+		if data[k] == 8<<3|3 {
+			if i == 0 {
+				return k
+			}
+			i--
+		}
+	}
+	t.Fatalf("record %d not found", i)
+	return 0
+}
+
+func TestDecode(t *testing.T) {
+	t.Parallel()
+
+	tests := []struct {
+		name      string
+		modify    func(data []uint8) []uint8
+		events    int
+		discarded int
+		overflows int
+	}{
+		{"complete", func(data []uint8) []uint8 { return data }, 40, 0, 0},
+		{"overflow", func(data []uint8) []uint8 { // values of EventRecord2 of iteration 22 lost
+			k := recordIndex(t, data, 0)
+			return append(append(data[:k+5:k+5], headerOverflow), data[k+20:]...)
+		}, 39, 1, 1},
+		{"first word", func(data []uint8) []uint8 { // first record of EventRecord4 lost
+			k := recordIndex(t, data, 1)
+			return append(data[:k:k], data[k+5:]...)
+		}, 39, 2, 0},
+		{"no record", func(data []uint8) []uint8 { // first word without valid flag
+			k := recordIndex(t, data, 0)
+			data[k+4] = 0
+			return data
+		}, 39, 1, 0},
+		{"truncated", func(data []uint8) []uint8 { // capture ends within EventRecordData
+			return data[:recordIndex(t, data, 3)+12]
+		}, 2, 1, 0},
+		{"other port", func(data []uint8) []uint8 { // stimulus port 10 is ignored
+			k := recordIndex(t, data, 0)
+			return append(append(data[:k:k], 10<<3|3, 1, 2, 3, 4), data[k:]...)
+		}, 40, 0, 0},
+	}
+	for _, tt := range tests {
+		tt := tt
+		t.Run(tt.name, func(t *testing.T) {
+			t.Parallel()
+			data, err := os.ReadFile(s24)
+			if err != nil {
+				t.Fatalf("ReadFile() error = %v", err)
+			}
+			var buf bytes.Buffer
+			res, err := Decode(bytes.NewReader(tt.modify(data)), &buf, 8)
+			if err != nil {
+				t.Fatalf("Decode() error = %v", err)
+			}
+			if res.Events != tt.events || res.Discarded != tt.discarded || res.Overflows != tt.overflows {
+				t.Errorf("Decode() = %v, want %d events, %d discarded, %d overflows", res, tt.events, tt.discarded, tt.overflows)
+			}
+			in := bufio.NewReader(&buf)
+			var evs []event.Data
+			for {
+				var ev event.Data
+				if ev.Read(in) != nil {
+					break
+				}
+				evs = append(evs, ev)
+			}
+			if len(evs) != tt.events {
+				t.Fatalf("Decode() read %d events, want %d", len(evs), tt.events)
+			}
+			if tt.name != "complete" {
+				return
+			}
+			// first event: EventRecord2 of iteration 22, the timer overflow occurred before the stream
+			if ev := evs[0]; ev.Info.ID != 0x0A00 || ev.Typ != 2 || ev.Value1 != 22 || uint32(ev.Value2) != 0x80000016 || ev.Time != 535 {
+				t.Errorf("Decode() event 0 = %v", ev)
+			}
+			if ev := evs[1]; ev.Info.ID != 0x0A01 || ev.Typ != 3 || uint32(ev.Value2) != 0xC0000000 || uint32(ev.Value4) != 0x80000004 {
+				t.Errorf("Decode() event 1 = %v", ev)
+			}
+			if ev := evs[2]; ev.Info.ID != 0x0A02 || ev.Typ != 1 || string(*ev.Data) != "abc" {
+				t.Errorf("Decode() event 2 = %v", ev)
+			}
+			if ev := evs[3]; ev.Info.ID != 0x0A03 || ev.Typ != 1 || string(*ev.Data) != "0123456789abcdefghij" {
+				t.Errorf("Decode() event 3 = %v", ev)
+			}
+		})
+	}
+}
+
+func TestDecode_err(t *testing.T) {
+	t.Parallel()
+
+	var buf bytes.Buffer
+	for _, port := range []int{-1, MaxPort + 1} {
+		if _, err := Decode(bytes.NewReader(nil), &buf, port); !errors.Is(err, ErrPort) {
+			t.Errorf("Decode() port %d error = %v, want %v", port, err, ErrPort)
+		}
+	}
+}
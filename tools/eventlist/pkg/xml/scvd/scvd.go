@@ -102,7 +102,7 @@ type Group struct {
 }
 
 type Events struct {
-	Group  Group   `xml:"group"`
+	Groups []Group `xml:"group"`
 	Events []Event `xml:"event"`
 }
 
@@ -139,22 +139,44 @@ func (id *ID) getIdValue() (uint16, error) { //nolint:golint,revive
 	return uint16(n.GetInt()), nil
 }
 
+// Load reads a SCVD file
+func Load(filename *string) (*ComponentViewer, error) {
+	var viewer ComponentViewer
+	if err := viewer.getFromFile(filename); err != nil {
+		return nil, err
+	}
+	return &viewer, nil
+}
+
+// Components returns the components of all event groups indexed by component number
+func (viewer *ComponentViewer) Components() (map[uint8]*GroupComponent, error) {
+	components := make(map[uint8]*GroupComponent)
+	for i := range viewer.Events.Groups {
+		for j := range viewer.Events.Groups[i].Component {
+			component := &viewer.Events.Groups[i].Component[j]
+			no, err := strconv.ParseUint(component.No, 0, 8)
+			if err != nil {
+				return nil, err
+			}
+			components[uint8(no)] = component
+		}
+	}
+	return components, nil
+}
+
+// Value returns the numeric event id
+func (id *ID) Value() (uint16, error) {
+	return id.getIdValue()
+}
+
 func getOne(filename *string, events map[uint16]Event,
 	typedefs map[string]map[string]map[int16]string) error {
 	var viewer ComponentViewer
 	var err error
 	if err = viewer.getFromFile(filename); err == nil {
 		// create a components map indexed by "no" to speed up things
-		components := make(map[uint8]*GroupComponent)
-		for _, component := range viewer.Events.Group.Component {
-			var no uint64
-			no, err = strconv.ParseUint(component.No, 0, 8)
-			if err != nil {
-				break
-			}
-			components[uint8(no)] = &component
-		}
-		if err != nil {
+		var components map[uint8]*GroupComponent
+		if components, err = viewer.Components(); err != nil {
 			return err // cannot decode component number
 		}
 		for _, event := range viewer.Events.Events {